@@ -23,7 +23,15 @@ set(OpenMP_cmake_included true)
 
 include("cmake/MKL.cmake")
 
-if(WIN32 AND ${CMAKE_CXX_COMPILER_ID} STREQUAL MSVC)
+if(NOT MKLDNN_THREADING STREQUAL "OMP")
+    # OpenMP is not used for threading, but `omp simd` pragmas are still
+    # honored where the compiler allows enabling them separately
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU" OR
+            CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -fopenmp-simd")
+        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fopenmp-simd")
+    endif()
+elseif(WIN32 AND ${CMAKE_CXX_COMPILER_ID} STREQUAL MSVC)
     add_definitions(/Qpar)
 else()
     find_package(OpenMP)
@@ -42,9 +50,20 @@ else()
     endif()
     if(OpenMP_CXX_FOUND)
         set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}")
+        add_definitions(-DMKLDNN_THR=MKLDNN_THR_OMP)
+    else()
+        message(WARNING "OpenMP is not found, falling back to sequential "
+            "execution (MKLDNN_THREADING=SEQ)")
+        add_definitions(-DMKLDNN_THR=MKLDNN_THR_SEQ)
     endif()
 endif()
 
+if(MKLDNN_THREADING STREQUAL "SEQ")
+    add_definitions(-DMKLDNN_THR=MKLDNN_THR_SEQ)
+elseif(MKLDNN_THREADING STREQUAL "THREADPOOL")
+    add_definitions(-DMKLDNN_THR=MKLDNN_THR_THREADPOOL)
+endif()
+
 # Do not link with compiler-native OpenMP library if MKL is present.
 # Rationale: MKL comes with Intel OpenMP library which is compatible with all
 # libraries shipped with compilers that MKL-DNN supports.
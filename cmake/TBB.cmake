@@ -0,0 +1,44 @@
+#===============================================================================
+# Copyright 2017 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#===============================================================================
+
+# Locate Intel(R) Threading Building Blocks if it is the threading runtime
+#===============================================================================
+
+if(TBB_cmake_included)
+    return()
+endif()
+set(TBB_cmake_included true)
+
+if(NOT MKLDNN_THREADING STREQUAL "TBB")
+    return()
+endif()
+
+find_path(TBB_INCLUDE_DIR tbb/task_arena.h
+    HINTS $ENV{TBBROOT}/include ${TBBROOT}/include)
+find_library(TBB_LIBRARY tbb
+    HINTS $ENV{TBBROOT}/lib ${TBBROOT}/lib
+    PATH_SUFFIXES intel64/gcc4.7 intel64/gcc4.4 intel64/vc14)
+
+if(NOT TBB_INCLUDE_DIR OR NOT TBB_LIBRARY)
+    message(FATAL_ERROR "Intel(R) TBB is not found (set TBBROOT to point "
+        "to it), or use MKLDNN_THREADING=OMP|SEQ")
+endif()
+
+include_directories(${TBB_INCLUDE_DIR})
+list(APPEND EXTRA_LIBS ${TBB_LIBRARY})
+add_definitions(-DMKLDNN_THR=MKLDNN_THR_TBB)
+
+message(STATUS "Intel(R) TBB: ${TBB_LIBRARY}")
@@ -199,6 +199,30 @@ mkldnn_status_t MKLDNN_API mkldnn_primitive_get_output(
         const_mkldnn_primitive_t primitive, size_t index,
         const_mkldnn_primitive_t *output);
 
+/** Sets the @p scratchpad buffer a @p primitive uses during the execution.
+ * Applicable only for primitives created with #mkldnn_scratchpad_mode_user.
+ * The buffer must be aligned on a 64-byte boundary, must be at least of the
+ * size returned by the #mkldnn_query_scratchpad_size query, must stay valid
+ * while the primitive executes, and may be shared by the primitives that do
+ * not execute concurrently. Returns #mkldnn_invalid_arguments if the buffer
+ * is @c NULL or misaligned while the primitive requires a scratchpad.
+ *
+ * @note
+ *     Currently only the Winograd convolutions take their scratchpad from
+ *     the user. The other primitives report a zero scratchpad size, accept
+ *     any buffer, and still allocate their temporary buffers themselves. */
+mkldnn_status_t MKLDNN_API mkldnn_primitive_set_scratchpad(
+        mkldnn_primitive_t primitive, void *scratchpad);
+
+/** Executes a @p primitive on the calling thread and returns when it is done.
+ * The parallel work is submitted to @p threadpool if it is not @c NULL and
+ * to the library threads otherwise. A non-NULL @p threadpool is supported
+ * only if the library is built with the THREADPOOL threading runtime,
+ * #mkldnn_unimplemented is returned otherwise. The @p threadpool structure
+ * is used only for the duration of the call. */
+mkldnn_status_t MKLDNN_API mkldnn_primitive_execute(
+        mkldnn_primitive_t primitive, const mkldnn_threadpool_t *threadpool);
+
 /** Deletes a @p primitive. */
 mkldnn_status_t MKLDNN_API mkldnn_primitive_destroy(
         mkldnn_primitive_t primitive);
@@ -329,6 +353,21 @@ mkldnn_status_t MKLDNN_API mkldnn_primitive_attr_get_post_ops(
 mkldnn_status_t MKLDNN_API mkldnn_primitive_attr_set_post_ops(
         mkldnn_primitive_attr_t attr, const_mkldnn_post_ops_t post_ops);
 
+/** Returns @p scratchpad_mode for a given @p attr, previously set by
+ * mkldnn_primitive_attr_set_scratchpad_mode. */
+mkldnn_status_t MKLDNN_API mkldnn_primitive_attr_get_scratchpad_mode(
+        const_mkldnn_primitive_attr_t attr,
+        mkldnn_scratchpad_mode_t *scratchpad_mode);
+
+/** Sets @p scratchpad_mode for a given @p attr. By default the library
+ * manages the scratchpad memory. With #mkldnn_scratchpad_mode_user the
+ * primitive does not allocate any scratchpad and the user is expected to
+ * provide a buffer with mkldnn_primitive_set_scratchpad() before the
+ * execution. */
+mkldnn_status_t MKLDNN_API mkldnn_primitive_attr_set_scratchpad_mode(
+        mkldnn_primitive_attr_t attr,
+        mkldnn_scratchpad_mode_t scratchpad_mode);
+
 /** @addtogroup c_api_attributes_post_ops Sequence of post operations
  * An extension for performing extra operations after base operation.
  * @{ */
@@ -455,7 +494,10 @@ size_t MKLDNN_API mkldnn_memory_primitive_desc_get_size(
 mkldnn_status_t MKLDNN_API mkldnn_memory_get_data_handle(
         const_mkldnn_primitive_t memory, void **handle);
 
-/** For a @p memory primitive, sets the data @p handle. */
+/** For a @p memory primitive, sets the data @p handle. A memory primitive
+ * without a data handle (e.g. a newly created one, or after setting a NULL
+ * @p handle) may only be used within a lazy stream, which then allocates it
+ * and owns the data till the stream is destroyed. */
 mkldnn_status_t MKLDNN_API mkldnn_memory_set_data_handle(
         mkldnn_primitive_t memory, void *handle);
 
@@ -958,6 +1000,38 @@ mkldnn_status_t MKLDNN_API mkldnn_engine_get_kind(mkldnn_engine_t engine,
 /** Destroys an @p engine. */
 mkldnn_status_t MKLDNN_API mkldnn_engine_destroy(mkldnn_engine_t engine);
 
+/** Sets the maximal number of primitive descriptors cached by an @p engine.
+ * Creating a primitive descriptor for an operation descriptor and attributes
+ * that are already in the cache skips the search over implementations. Pass
+ * zero @p capacity to disable the cache. Primitive descriptors created with a
+ * hint are never cached. */
+mkldnn_status_t MKLDNN_API mkldnn_engine_set_primitive_desc_cache_capacity(
+        mkldnn_engine_t engine, int capacity);
+
+/** Returns the maximal number of primitive descriptors cached by an
+ * @p engine. */
+mkldnn_status_t MKLDNN_API mkldnn_engine_get_primitive_desc_cache_capacity(
+        mkldnn_engine_t engine, int *capacity);
+
+/** Returns the number of @p hits and @p misses of the primitive descriptor
+ * cache of an @p engine since its creation. Either pointer can be @c NULL. */
+mkldnn_status_t MKLDNN_API mkldnn_engine_get_primitive_desc_cache_stats(
+        mkldnn_engine_t engine, size_t *hits, size_t *misses);
+
+/** Enables (@p tuning is non-zero) or disables the tuning of an @p engine.
+ * When enabled, the first creation of a primitive descriptor for an operation
+ * descriptor and attributes without a hint executes every implementation
+ * that accepts the operation and picks the fastest one. The choice is
+ * remembered for the current instruction set and number of threads, so the
+ * subsequent creations do not measure again. Toggling the tuning clears the
+ * primitive descriptor cache. */
+mkldnn_status_t MKLDNN_API mkldnn_engine_set_tuning(mkldnn_engine_t engine,
+        int tuning);
+
+/** Returns whether the tuning of an @p engine is enabled. */
+mkldnn_status_t MKLDNN_API mkldnn_engine_get_tuning(mkldnn_engine_t engine,
+        int *tuning);
+
 /** @} */
 
 /** @addtogroup c_api_stream Execution stream operations
@@ -967,16 +1041,31 @@ mkldnn_status_t MKLDNN_API mkldnn_engine_destroy(mkldnn_engine_t engine);
 mkldnn_status_t MKLDNN_API mkldnn_stream_create(mkldnn_stream_t *stream,
         mkldnn_stream_kind_t stream_kind);
 
+/** Creates an execution @p stream of @p stream_kind that runs the primitives
+ * on the user-provided @p threadpool instead of the threads of the library.
+ * The @p threadpool structure is copied, but its context must stay valid
+ * while the stream is alive. Returns #mkldnn_unimplemented unless the library
+ * is built with the THREADPOOL threading runtime. */
+mkldnn_status_t MKLDNN_API mkldnn_stream_create_with_threadpool(
+        mkldnn_stream_t *stream, mkldnn_stream_kind_t stream_kind,
+        const mkldnn_threadpool_t *threadpool);
+
 /** Submits @p primitives to an execution @p stream. The number of primitives
  * is @p n.  All or none of the primitives can be lazy. In case of an error,
- * returns the offending @p error_primitive if it is not @c NULL. */
+ * returns the offending @p error_primitive if it is not @c NULL.
+ *
+ * @note
+ *     The primitives submitted to an #mkldnn_eager_async stream may still be
+ *     executing when the function returns, so they and their memory must be
+ *     kept alive until mkldnn_stream_wait() reports the stream is done. */
 mkldnn_status_t MKLDNN_API mkldnn_stream_submit(mkldnn_stream_t stream,
         size_t n, mkldnn_primitive_t primitives[],
         mkldnn_primitive_t *error_primitive);
 
 /** Waits for all primitives in the execution @p stream to finish. Returns
- * immediately if @p block is zero. In case of an error, returns
- * the offending @p error_primitive if it is not @c NULL. */
+ * immediately if @p block is zero, with #mkldnn_try_again if the primitives
+ * are still executing. In case of an error, returns the offending
+ * @p error_primitive if it is not @c NULL. */
 mkldnn_status_t MKLDNN_API mkldnn_stream_wait(mkldnn_stream_t stream,
         int block, mkldnn_primitive_t *error_primitive);
 
@@ -990,6 +1079,38 @@ mkldnn_status_t MKLDNN_API mkldnn_stream_destroy(mkldnn_stream_t stream);
 
 /** @} */
 
+/** @addtogroup c_api_service Service functions
+ * @{ */
+
+/** Sets verbosity @p level (0 -- no output, 1 -- print a line per executed
+ * primitive with its implementation, memory formats and execution time, 2 --
+ * additionally print a line per created primitive). The initial level is
+ * taken from the MKLDNN_VERBOSE environment variable and is 0 if the variable
+ * is not set. */
+mkldnn_status_t MKLDNN_API mkldnn_verbose_set(int level);
+
+/** Limits the instruction set the CPU jit implementations are allowed to use
+ * to @p isa, which makes it possible to run and benchmark the code paths for
+ * older processors. The initial limit is taken from the MKLDNN_MAX_CPU_ISA
+ * environment variable (SSE42, AVX2, AVX512_COMMON, AVX512_CORE, AVX512_MIC,
+ * AVX512_MIC_4OPS or ALL, case-insensitive) and is #mkldnn_isa_all if the
+ * variable is not set. An unknown value is reported to stderr and treated as
+ * ALL.
+ *
+ * @note
+ *   The limit affects the primitive descriptors and primitives created after
+ *   the call. Primitive descriptors being created concurrently with the call
+ *   may see either limit. */
+mkldnn_status_t MKLDNN_API mkldnn_set_max_cpu_isa(mkldnn_cpu_isa_t isa);
+
+/** Returns the number of distinct jit kernels shared by the primitives alive
+ * in the process (@p n_kernels) and the total number of references the
+ * primitives hold to them (@p n_references). Either pointer can be @c NULL. */
+mkldnn_status_t MKLDNN_API mkldnn_get_jit_kernel_cache_stats(int *n_kernels,
+        int *n_references);
+
+/** @} */
+
 /** @} */
 
 #ifdef __cplusplus
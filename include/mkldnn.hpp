@@ -23,6 +23,7 @@
 #include <memory>
 #include <vector>
 #include <algorithm>
+#include <functional>
 #include <iterator>
 
 #include "mkldnn.h"
@@ -98,6 +99,8 @@ template <> struct handle_traits<mkldnn_primitive_t> {
 };
 #endif
 
+struct threadpool_iface;
+
 /// Base class for all computational primitives.
 class primitive: public handle<mkldnn_primitive_t> {
     friend struct error;
@@ -143,6 +146,18 @@ public:
 
     /// Returns the descriptor of the underlying C API primitive
     inline const_mkldnn_primitive_desc_t get_primitive_desc() const;
+
+    /// Returns the size of the scratchpad the primitive requires
+    inline size_t get_scratchpad_size() const;
+
+    /// Sets the scratchpad for the primitive created with
+    /// #scratchpad_mode_user
+    inline void set_scratchpad(void *scratchpad) const;
+
+    /// Executes the primitive on the calling thread, submitting the parallel
+    /// work to @p threadpool (see mkldnn_primitive_execute()) or to the
+    /// library threads if it is @c nullptr
+    inline void execute(threadpool_iface *threadpool = nullptr) const;
     // TODO: use the C++ API wrapper structure.
 };
 
@@ -209,6 +224,19 @@ const_mkldnn_primitive_desc_t primitive::get_primitive_desc() const {
             "could not get primitive descriptor by primitive");
     return pd;
 }
+
+size_t primitive::get_scratchpad_size() const {
+    size_t size;
+    error::wrap_c_api(mkldnn_primitive_desc_query(get_primitive_desc(),
+                mkldnn_query_scratchpad_size, 0, &size),
+            "could not query scratchpad size");
+    return size;
+}
+
+void primitive::set_scratchpad(void *scratchpad) const {
+    error::wrap_c_api(mkldnn_primitive_set_scratchpad(get(), scratchpad),
+            "could not set scratchpad");
+}
 /// @}
 
 /// @addtogroup cpp_api_enums Common data types and enumerations
@@ -223,6 +251,15 @@ inline mkldnn_round_mode_t convert_to_c(round_mode mode) {
     return static_cast<mkldnn_round_mode_t>(mode);
 }
 
+enum scratchpad_mode {
+    scratchpad_mode_library = mkldnn_scratchpad_mode_library,
+    scratchpad_mode_user = mkldnn_scratchpad_mode_user,
+};
+
+inline mkldnn_scratchpad_mode_t convert_to_c(scratchpad_mode mode) {
+    return static_cast<mkldnn_scratchpad_mode_t>(mode);
+}
+
 enum padding_kind {
     zero = mkldnn_padding_zero
 };
@@ -296,6 +333,8 @@ enum query {
 
     impl_info_str = mkldnn_query_impl_info_str,
 
+    scratchpad_size = mkldnn_query_scratchpad_size,
+
     memory_d = mkldnn_query_memory_d,
     convolution_d = mkldnn_query_convolution_d,
     eltwise_d = mkldnn_query_eltwise_d,
@@ -439,6 +478,19 @@ struct primitive_attr: public handle<mkldnn_primitive_attr_t> {
         error::wrap_c_api(mkldnn_primitive_attr_set_post_ops(get(), ops.get()),
                 "could not set post operation sequence");
     }
+
+    scratchpad_mode get_scratchpad_mode() const {
+        mkldnn_scratchpad_mode_t result;
+        error::wrap_c_api(mkldnn_primitive_attr_get_scratchpad_mode(
+                    get(), &result), "could not get scratchpad mode");
+        return scratchpad_mode(result);
+    }
+
+    void set_scratchpad_mode(scratchpad_mode mode) {
+        error::wrap_c_api(mkldnn_primitive_attr_set_scratchpad_mode(
+                    get(), mkldnn::convert_to_c(mode)),
+                "could not set scratchpad mode");
+    }
 };
 
 /// @}
@@ -511,6 +563,55 @@ struct engine: public handle<mkldnn_engine_t> {
         return engine(engine_q);
     }
 
+    /// Sets the maximal number of cached primitive descriptors.
+    ///
+    /// @param capacity The number of entries, zero disables the cache.
+
+    void set_primitive_desc_cache_capacity(int capacity) {
+        error::wrap_c_api(
+                mkldnn_engine_set_primitive_desc_cache_capacity(get(),
+                    capacity),
+                "could not set primitive descriptor cache capacity");
+    }
+
+    /// Returns the maximal number of cached primitive descriptors.
+
+    int get_primitive_desc_cache_capacity() const {
+        int capacity;
+        error::wrap_c_api(
+                mkldnn_engine_get_primitive_desc_cache_capacity(get(),
+                    &capacity),
+                "could not get primitive descriptor cache capacity");
+        return capacity;
+    }
+
+    /// Returns the number of hits and misses of the primitive descriptor
+    /// cache.
+
+    void get_primitive_desc_cache_stats(size_t &hits, size_t &misses) const {
+        error::wrap_c_api(
+                mkldnn_engine_get_primitive_desc_cache_stats(get(), &hits,
+                    &misses),
+                "could not get primitive descriptor cache stats");
+    }
+
+    /// Enables or disables picking the fastest implementation by measuring
+    /// the candidates when primitive descriptors are created.
+
+    void set_tuning(bool tuning) {
+        error::wrap_c_api(mkldnn_engine_set_tuning(get(), tuning),
+                "could not set engine tuning");
+    }
+
+    /// Returns whether the tuning is enabled.
+
+    bool get_tuning() const {
+        int tuning;
+        error::wrap_c_api(mkldnn_engine_get_tuning(get(), &tuning),
+                "could not get engine tuning");
+        return tuning != 0;
+    }
+
 private:
     static mkldnn_engine_kind_t convert_to_c(kind akind) {
         return static_cast<mkldnn_engine_kind_t>(akind);
@@ -2774,12 +2875,48 @@ template <> struct handle_traits<mkldnn_stream_t> {
 };
 #endif
 
+/// An interface of a user-provided threadpool the primitives are executed on
+/// (see mkldnn_threadpool_t).
+struct threadpool_iface {
+    /// Returns the number of worker threads.
+    virtual int get_num_threads() = 0;
+    /// Calls @p fn(i, n) for each i in [0, @p n) and returns when all the
+    /// calls are finished.
+    virtual void parallel_for(int n,
+            const std::function<void(int, int)> &fn) = 0;
+    virtual ~threadpool_iface() {}
+
+    /// Returns the C API structure forwarding the calls to this object.
+    mkldnn_threadpool_t get_c_threadpool() {
+        mkldnn_threadpool_t tp;
+        tp.ctx = this;
+        tp.get_num_threads = [](void *ctx) {
+            return static_cast<threadpool_iface *>(ctx)->get_num_threads();
+        };
+        tp.parallel_for = [](void *ctx, int n,
+                void (*fn)(void *, int, int), void *fn_arg) {
+            static_cast<threadpool_iface *>(ctx)->parallel_for(n,
+                    [=](int i, int n) { fn(fn_arg, i, n); });
+        };
+        return tp;
+    }
+};
+
+void primitive::execute(threadpool_iface *threadpool) const {
+    mkldnn_threadpool_t tp;
+    if (threadpool) tp = threadpool->get_c_threadpool();
+    error::wrap_c_api(mkldnn_primitive_execute(get(),
+                threadpool ? &tp : nullptr),
+            "could not execute a primitive");
+}
+
 struct stream: public handle<mkldnn_stream_t> {
     using handle::handle;
 
     enum kind { any = mkldnn_stream_kind_t::mkldnn_any_stream,
         eager = mkldnn_stream_kind_t::mkldnn_eager,
-        lazy = mkldnn_stream_kind_t::mkldnn_lazy };
+        lazy = mkldnn_stream_kind_t::mkldnn_lazy,
+        eager_async = mkldnn_stream_kind_t::mkldnn_eager_async };
 
     static mkldnn_stream_kind_t convert_to_c(kind akind) {
         return static_cast<mkldnn_stream_kind_t>(akind);
@@ -2793,6 +2930,17 @@ struct stream: public handle<mkldnn_stream_t> {
         reset(astream);
     }
 
+    /// Constructs a stream executing the primitives on @p athreadpool, which
+    /// must outlive the stream.
+    stream(kind akind, threadpool_iface &athreadpool) {
+        const mkldnn_threadpool_t tp = athreadpool.get_c_threadpool();
+        mkldnn_stream_t astream;
+        error::wrap_c_api(mkldnn_stream_create_with_threadpool(&astream,
+                    convert_to_c(akind), &tp),
+                "could not create a stream with a threadpool");
+        reset(astream);
+    }
+
     /// Submits a vector of primitives to a stream for computations.
     ///
     /// @param primitives The vector of primitives to submit.
@@ -2846,6 +2994,44 @@ struct stream: public handle<mkldnn_stream_t> {
 
 /// @}
 
+/// @addtogroup cpp_api_service Service functions
+/// @{
+
+/// Sets verbosity level: 0 -- no output, 1 -- executed primitives,
+/// 2 -- executed and created primitives.
+inline void verbose_set(int level) {
+    error::wrap_c_api(mkldnn_verbose_set(level),
+            "could not set verbosity level");
+}
+
+/// Instruction sets the CPU jit implementations may use.
+enum cpu_isa {
+    isa_all = mkldnn_isa_all,
+    sse42 = mkldnn_sse42,
+    avx2 = mkldnn_avx2,
+    avx512_common = mkldnn_avx512_common,
+    avx512_core = mkldnn_avx512_core,
+    avx512_mic = mkldnn_avx512_mic,
+    avx512_mic_4ops = mkldnn_avx512_mic_4ops,
+};
+
+/// Limits the instruction set the CPU jit implementations are allowed to use.
+inline void set_max_cpu_isa(cpu_isa isa) {
+    error::wrap_c_api(
+            mkldnn_set_max_cpu_isa(static_cast<mkldnn_cpu_isa_t>(isa)),
+            "could not set max cpu isa");
+}
+
+/// Returns the number of jit kernels shared by the primitives alive in the
+/// process and the total number of references to them.
+inline void get_jit_kernel_cache_stats(int &n_kernels, int &n_references) {
+    error::wrap_c_api(
+            mkldnn_get_jit_kernel_cache_stats(&n_kernels, &n_references),
+            "could not get jit kernel cache stats");
+}
+
+/// @}
+
 /// @} C++ API
 
 } // namespace mkldnn
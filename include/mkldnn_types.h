@@ -82,6 +82,17 @@ typedef enum {
     mkldnn_round_down = 2,
 } mkldnn_round_mode_t;
 
+/** Scratchpad mode */
+typedef enum {
+    /** The library allocates and manages the scratchpad memory */
+    mkldnn_scratchpad_mode_library = 1,
+    /** The user provides the scratchpad memory, see
+     * mkldnn_primitive_set_scratchpad(). Only the scratchpad reported by
+     * #mkldnn_query_scratchpad_size is provided by the user, the primitives
+     * may still allocate their other temporary buffers */
+    mkldnn_scratchpad_mode_user = 2,
+} mkldnn_scratchpad_mode_t;
+
 /** Memory format specification.
  *
  * Intel(R) MKL-DNN uses the following notation for memory format names:
@@ -822,6 +833,7 @@ typedef struct {
  *      --------------------------------------------------------------
  *      #mkldnn_query_engine         | mkldnn_engine_t *
  *      #mkldnn_query_primitive_kind | mkldnn_primitive_kind_t *
+ *      #mkldnn_query_scratchpad_size | size_t *
  *      *_s32                        | int *
  *      *_s64                        | ptrdiff_t *
  *      *_f64                        | double *
@@ -849,13 +861,29 @@ typedef enum {
     mkldnn_query_num_of_inputs_s32, /**< number of inputs expected */
     mkldnn_query_num_of_outputs_s32, /**< number of outputs expected */
 
-    mkldnn_query_time_estimate_f64, /**< runtime estimation (seconds) */
+    mkldnn_query_time_estimate_f64, /**< runtime estimation (seconds): an
+                                      analytical estimate from the amount of
+                                      work and memory traffic, the ISA and
+                                      the number of threads, which is meant
+                                      to compare the implementations and the
+                                      algorithms (e.g. direct vs winograd).
+                                      Implemented for the convolution,
+                                      pooling, batch normalization and inner
+                                      product */
     mkldnn_query_memory_consumption_s64, /**< memory consumption -- extra
                                            (scratch) memory, additional to all
-                                           inputs and outputs memory (bytes) */
+                                           inputs and outputs memory (bytes).
+                                           Includes the scratchpad, the
+                                           workspaces of the reductions, the
+                                           im2col buffers and the partial
+                                           sums of the gemm the primitive
+                                           allocates */
 
     mkldnn_query_impl_info_str, /**< implementation name */
 
+    mkldnn_query_scratchpad_size, /**< size of the scratchpad the primitive
+                                    requires during the execution (bytes) */
+
     /* memory and op descriptor section */
     mkldnn_query_some_d = 64, /**< stub */
     mkldnn_query_memory_d, /**< memory descriptor for memory and view */
@@ -893,8 +921,18 @@ typedef enum {
     mkldnn_any_stream,
     /** Eager stream. */
     mkldnn_eager,
-    /** Lazy stream. */
+    /** Lazy stream. The primitives are executed at the wait; beforehand a
+     * convolution is merged with the following relu or in-place sum and a
+     * batch normalization with the following relu (forward inference only),
+     * and back-to-back reorders are merged or dropped. The memory passed
+     * between merged primitives only is left untouched. The memory without
+     * a data handle is allocated by the stream, the memories that are never
+     * live at the same time share the storage. */
     mkldnn_lazy,
+    /** Asynchronous eager stream. The primitives are executed by the threads
+     * of the stream as soon as the primitives they depend on are done; the
+     * independent ones may run concurrently. */
+    mkldnn_eager_async,
 } mkldnn_stream_kind_t;
 
 /** @struct mkldnn_stream
@@ -905,6 +943,47 @@ typedef struct mkldnn_stream *mkldnn_stream_t;
 /** A constant execution stream handle. */
 typedef const struct mkldnn_stream *const_mkldnn_stream_t;
 
+/** A user-provided threadpool the primitives are executed on (see
+ * mkldnn_stream_create_with_threadpool()). */
+typedef struct {
+    /** User context passed to the callbacks. */
+    void *ctx;
+    /** Returns the number of worker threads of the threadpool. */
+    int (*get_num_threads)(void *ctx);
+    /** Calls @p fn(@p fn_arg, i, @p n) for each i in [0, @p n) and returns
+     * when all the calls are finished. The calls may run on any threads and
+     * in any order; the library never waits for one call from another. */
+    void (*parallel_for)(void *ctx, int n,
+            void (*fn)(void *fn_arg, int i, int n), void *fn_arg);
+} mkldnn_threadpool_t;
+
+/** @} */
+
+/** @addtogroup c_api_types_cpu_isa CPU instruction set
+ * @{ */
+
+/** Instruction sets the CPU jit implementations may use. Limiting the
+ * implementations to an instruction set allows only that instruction set and
+ * the ones it extends: e.g. #mkldnn_avx512_mic allows #mkldnn_avx512_common,
+ * #mkldnn_avx2 and #mkldnn_sse42, but not #mkldnn_avx512_core. */
+typedef enum {
+    /** No limitation (default). */
+    mkldnn_isa_all = 0,
+    /** Intel(R) SSE4.2. */
+    mkldnn_sse42 = 1,
+    /** Intel(R) AVX2. */
+    mkldnn_avx2 = 2,
+    /** Intel(R) AVX-512 foundation subset. */
+    mkldnn_avx512_common = 3,
+    /** Intel(R) AVX-512 subset for Intel(R) Xeon(R) processors. */
+    mkldnn_avx512_core = 4,
+    /** Intel(R) AVX-512 subset for Intel(R) Xeon Phi(TM) processors. */
+    mkldnn_avx512_mic = 5,
+    /** Intel(R) AVX-512 with 4FMAPS and 4VNNIW extensions for Intel(R) Xeon
+     * Phi(TM) processors. */
+    mkldnn_avx512_mic_4ops = 6,
+} mkldnn_cpu_isa_t;
+
 /** @} */
 /** @} */
 /** @} */
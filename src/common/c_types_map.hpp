@@ -94,6 +94,12 @@ namespace round_mode {
     const round_mode_t down = mkldnn_round_down;
 }
 
+using scratchpad_mode_t = mkldnn_scratchpad_mode_t;
+namespace scratchpad_mode {
+    const scratchpad_mode_t library = mkldnn_scratchpad_mode_library;
+    const scratchpad_mode_t user = mkldnn_scratchpad_mode_user;
+}
+
 using memory_format_t = mkldnn_memory_format_t;
 namespace memory_format {
     const memory_format_t undef = mkldnn_format_undef;
@@ -185,6 +191,8 @@ namespace query {
 
     const query_t impl_info_str = mkldnn_query_impl_info_str;
 
+    const query_t scratchpad_size = mkldnn_query_scratchpad_size;
+
     const query_t some_d = mkldnn_query_some_d;
     const query_t memory_d = mkldnn_query_memory_d;
     const query_t convolution_d = mkldnn_query_convolution_d;
@@ -273,6 +281,7 @@ namespace stream_kind {
     const stream_kind_t any_stream = mkldnn_any_stream;
     const stream_kind_t eager = mkldnn_eager;
     const stream_kind_t lazy = mkldnn_lazy;
+    const stream_kind_t eager_async = mkldnn_eager_async;
 }
 using stream_t = mkldnn_stream;
 
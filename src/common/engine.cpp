@@ -19,6 +19,8 @@
 #include "nstl.hpp"
 
 #include "c_types_map.hpp"
+#include "primitive_desc_cache.hpp"
+#include "primitive_desc_tuner.hpp"
 #include "../cpu/cpu_engine.hpp"
 
 namespace mkldnn {
@@ -96,4 +98,58 @@ status_t mkldnn_engine_destroy(engine_t *engine) {
     return success;
 }
 
+status_t mkldnn_engine_set_primitive_desc_cache_capacity(engine_t *engine,
+        int capacity) {
+    if (engine == nullptr || capacity < 0)
+        return invalid_arguments;
+    primitive_desc_cache_t *cache = engine->pd_cache();
+    if (cache == nullptr)
+        return unimplemented;
+    cache->set_capacity(capacity);
+    return success;
+}
+
+status_t mkldnn_engine_get_primitive_desc_cache_capacity(
+        engine_t *engine, int *capacity) {
+    if (utils::any_null(engine, capacity))
+        return invalid_arguments;
+    primitive_desc_cache_t *cache = engine->pd_cache();
+    if (cache == nullptr)
+        return unimplemented;
+    *capacity = cache->capacity();
+    return success;
+}
+
+status_t mkldnn_engine_get_primitive_desc_cache_stats(engine_t *engine,
+        size_t *hits, size_t *misses) {
+    if (engine == nullptr)
+        return invalid_arguments;
+    primitive_desc_cache_t *cache = engine->pd_cache();
+    if (cache == nullptr)
+        return unimplemented;
+    cache->get_stats(hits, misses);
+    return success;
+}
+
+status_t mkldnn_engine_set_tuning(engine_t *engine, int tuning) {
+    if (engine == nullptr)
+        return invalid_arguments;
+    primitive_desc_tuner_t *tuner = engine->pd_tuner();
+    if (tuner == nullptr)
+        return unimplemented;
+    tuner->set_enabled(tuning != 0);
+    /* the cached primitive descriptors were chosen in the other mode */
+    primitive_desc_cache_t *cache = engine->pd_cache();
+    if (cache) cache->clear();
+    return success;
+}
+
+status_t mkldnn_engine_get_tuning(engine_t *engine, int *tuning) {
+    if (utils::any_null(engine, tuning))
+        return invalid_arguments;
+    primitive_desc_tuner_t *tuner = engine->pd_tuner();
+    *tuning = tuner != nullptr && tuner->enabled();
+    return success;
+}
+
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -24,6 +24,13 @@
 #include "primitive.hpp"
 #include "utils.hpp"
 
+namespace mkldnn {
+namespace impl {
+struct primitive_desc_cache_t;
+struct primitive_desc_tuner_t;
+}
+}
+
 /** \brief An abstraction of an execution unit with shared resources
  *
  * Responsibilities:
@@ -141,6 +148,16 @@ struct mkldnn_engine: public mkldnn::impl::c_compatible {
      * NULL-terminated list */
     virtual const primitive_desc_create_f* get_implementation_list() const;
 
+    /** return the cache of primitive descriptors or @c nullptr if the engine
+     * does not cache them */
+    virtual mkldnn::impl::primitive_desc_cache_t *pd_cache() const
+    { return nullptr; }
+
+    /** return the tuner of the implementation choices or @c nullptr if the
+     * engine does not tune them */
+    virtual mkldnn::impl::primitive_desc_tuner_t *pd_tuner() const
+    { return nullptr; }
+
 protected:
     mkldnn::impl::engine_kind_t kind_;
 };
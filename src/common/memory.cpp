@@ -46,7 +46,7 @@ status_t mkldnn_memory_desc_init(memory_desc_t *memory_desc, int ndims,
         && one_of(data_type, f32, s32, s16, s8, u8);
     if (!args_ok) return invalid_arguments;
 
-    memory_desc_t md;
+    memory_desc_t md = {};
     md.ndims = ndims;
     array_copy(md.dims, dims, ndims);
     md.primitive_kind = primitive_kind::memory;
@@ -171,7 +171,7 @@ status_t mkldnn_memory_get_data_handle(const primitive_t *memory,
 }
 
 status_t mkldnn_memory_set_data_handle(primitive_t *memory, void *handle) {
-    if (any_null(memory, handle) || memory->kind() != primitive_kind::memory)
+    if (any_null(memory) || memory->kind() != primitive_kind::memory)
         return invalid_arguments;
     return memory->set_data_handle(handle);
 }
@@ -136,6 +136,9 @@ struct sum_pd_t: public primitive_desc_t {
     { return index == 0 ? dst_pd() : nullptr; }
     virtual int n_inputs() const override { return n_; }
     virtual int n_outputs() const override { return 1; }
+
+    /** the scale of the @p index-th input */
+    virtual float scale(int index) const = 0;
 protected:
     int n_;
 };
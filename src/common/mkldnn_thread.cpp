@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn_thread.hpp"
+
+#if MKLDNN_THR == MKLDNN_THR_TBB
+namespace mkldnn {
+namespace impl {
+namespace tbb_utils {
+
+namespace {
+thread_local int region_active = 0;
+}
+
+int in_parallel() { return region_active; }
+
+region_guard_t::region_guard_t(): saved_(region_active) { region_active = 1; }
+region_guard_t::~region_guard_t() { region_active = saved_; }
+
+}
+}
+}
+#endif
+
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+#include <thread>
+
+#include "nstl.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace threadpool_utils {
+
+namespace {
+/* the state of the calling thread: the threadpool it submits the work to and
+ * its position in the parallel() region it runs in (if any) */
+thread_local const mkldnn_threadpool_t *active_threadpool = nullptr;
+thread_local int region_ithr = 0;
+thread_local int region_nthr = 1;
+thread_local bool region_active = false;
+
+/* the primitives size their per-thread buffers at creation, i.e. before the
+ * threadpool is known, hence the number of threads is capped by this value */
+int default_max_threads() {
+    static const int nthr
+        = nstl::max(1, (int)std::thread::hardware_concurrency());
+    return nthr;
+}
+}
+
+const mkldnn_threadpool_t *get_active_threadpool() {
+    return active_threadpool;
+}
+
+void activate_threadpool(const mkldnn_threadpool_t *threadpool) {
+    active_threadpool = threadpool;
+}
+
+int get_max_threads() {
+    if (region_active) return 1;
+    if (active_threadpool == nullptr) return default_max_threads();
+    const int nthr = active_threadpool->get_num_threads(active_threadpool->ctx);
+    return nstl::max(1, nstl::min(nthr, default_max_threads()));
+}
+
+int get_num_threads() { return region_nthr; }
+int get_thread_num() { return region_ithr; }
+int in_parallel() { return region_active; }
+
+void parallel_for(int nthr, void (*fn)(void *, int, int), void *fn_arg) {
+    struct region_t {
+        const mkldnn_threadpool_t *threadpool;
+        void (*fn)(void *, int, int);
+        void *fn_arg;
+    } region = { active_threadpool, fn, fn_arg };
+
+    auto task = [](void *arg, int ithr, int nthr) {
+        const region_t *r = static_cast<const region_t *>(arg);
+
+        /* the task may run on any thread, including the submitting one */
+        const mkldnn_threadpool_t *saved_threadpool = active_threadpool;
+        const int saved_ithr = region_ithr, saved_nthr = region_nthr;
+        const bool saved_active = region_active;
+
+        active_threadpool = r->threadpool;
+        region_ithr = ithr;
+        region_nthr = nthr;
+        region_active = true;
+
+        r->fn(r->fn_arg, ithr, nthr);
+
+        active_threadpool = saved_threadpool;
+        region_ithr = saved_ithr;
+        region_nthr = saved_nthr;
+        region_active = saved_active;
+    };
+
+    active_threadpool->parallel_for(active_threadpool->ctx, nthr, task,
+            &region);
+}
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
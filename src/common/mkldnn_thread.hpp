@@ -17,15 +17,107 @@
 #ifndef MKLDNN_THREAD_HPP
 #define MKLDNN_THREAD_HPP
 
+#include "mkldnn_types.h"
+
 #include "utils.hpp"
 
-#if defined(_OPENMP)
+#define MKLDNN_THR_SEQ 0
+#define MKLDNN_THR_OMP 1
+#define MKLDNN_THR_TBB 2
+#define MKLDNN_THR_THREADPOOL 3
+
+/* the threading runtime is chosen at build time (see MKLDNN_THREADING cmake
+ * option); the library built by other means falls back to OpenMP if it is
+ * enabled and to sequential execution otherwise */
+#if !defined(MKLDNN_THR)
+#   if defined(_OPENMP)
+#       define MKLDNN_THR MKLDNN_THR_OMP
+#   else
+#       define MKLDNN_THR MKLDNN_THR_SEQ
+#   endif
+#endif
+
+/* MKLDNN_THR_SYNC is 1 if all the threads of a parallel() region are
+ * guaranteed to run concurrently, i.e. the threads may synchronize with
+ * each other (e.g. using barriers). Implementations relying on that must not
+ * be used otherwise */
+#if MKLDNN_THR == MKLDNN_THR_SEQ
+#define MKLDNN_THR_SYNC 1
+inline int mkldnn_get_max_threads() { return 1; }
+inline int mkldnn_get_num_threads() { return 1; }
+inline int mkldnn_get_thread_num() { return 0; }
+inline int mkldnn_in_parallel() { return 0; }
+inline void mkldnn_thr_barrier() {}
+
+#elif MKLDNN_THR == MKLDNN_THR_OMP
 #include <omp.h>
+#define MKLDNN_THR_SYNC 1
+inline int mkldnn_get_max_threads() { return omp_get_max_threads(); }
+inline int mkldnn_get_num_threads() { return omp_get_num_threads(); }
+inline int mkldnn_get_thread_num() { return omp_get_thread_num(); }
+inline int mkldnn_in_parallel() { return omp_in_parallel(); }
+inline void mkldnn_thr_barrier() {
+#   pragma omp barrier
+}
+
+#elif MKLDNN_THR == MKLDNN_THR_TBB
+#include "tbb/task_arena.h"
+#include "tbb/parallel_for.h"
+#define MKLDNN_THR_SYNC 0
+inline int mkldnn_get_max_threads()
+{ return tbb::this_task_arena::max_concurrency(); }
+inline int mkldnn_get_num_threads() { return mkldnn_get_max_threads(); }
+inline int mkldnn_get_thread_num()
+{ return tbb::this_task_arena::current_thread_index(); }
+namespace mkldnn {
+namespace impl {
+namespace tbb_utils {
+/* every thread of the arena has a valid index, hence whether the calling
+ * thread runs a parallel() region is tracked separately */
+int in_parallel();
+struct region_guard_t {
+    region_guard_t();
+    ~region_guard_t();
+private:
+    int saved_;
+};
+}
+}
+}
+inline int mkldnn_in_parallel()
+{ return mkldnn::impl::tbb_utils::in_parallel(); }
+inline void mkldnn_thr_barrier() { assert(!"no barrier in TBB"); }
+
+#elif MKLDNN_THR == MKLDNN_THR_THREADPOOL
+#define MKLDNN_THR_SYNC 0
+namespace mkldnn {
+namespace impl {
+namespace threadpool_utils {
+/* the threadpool of the stream executing primitives on the calling thread,
+ * nullptr if none (the work is executed by the calling thread then) */
+const mkldnn_threadpool_t *get_active_threadpool();
+void activate_threadpool(const mkldnn_threadpool_t *threadpool);
+
+int get_max_threads();
+int get_num_threads();
+int get_thread_num();
+int in_parallel();
+void parallel_for(int nthr, void (*fn)(void *, int, int), void *fn_arg);
+}
+}
+}
+inline int mkldnn_get_max_threads()
+{ return mkldnn::impl::threadpool_utils::get_max_threads(); }
+inline int mkldnn_get_num_threads()
+{ return mkldnn::impl::threadpool_utils::get_num_threads(); }
+inline int mkldnn_get_thread_num()
+{ return mkldnn::impl::threadpool_utils::get_thread_num(); }
+inline int mkldnn_in_parallel()
+{ return mkldnn::impl::threadpool_utils::in_parallel(); }
+inline void mkldnn_thr_barrier() { assert(!"no barrier in threadpool"); }
+
 #else
-inline int omp_get_max_threads() { return 1; }
-inline int omp_get_num_threads() { return 1; }
-inline int omp_get_thread_num() { return 0; }
-inline int omp_in_parallel() { return 0; }
+#   error "unknown threading runtime (MKLDNN_THR)"
 #endif
 
 /* VisualStudio still support omp 2.0 */
@@ -56,9 +148,37 @@ inline void balance211(T n, U team, U tid, T &n_start, T &n_end) {
     n_end += n_start;
 }
 
+/* makes the primitives executed by the calling thread use @p threadpool while
+ * the guard is alive; nullptr keeps the threadpool that is active already.
+ * Only the THREADPOOL runtime supports user threadpools, the guard does
+ * nothing otherwise */
+struct threadpool_guard_t {
+    threadpool_guard_t(const mkldnn_threadpool_t *threadpool) {
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+        saved_ = threadpool_utils::get_active_threadpool();
+        if (threadpool)
+            threadpool_utils::activate_threadpool(threadpool);
+#else
+        UNUSED(threadpool);
+#endif
+    }
+    ~threadpool_guard_t() {
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+        threadpool_utils::activate_threadpool(saved_);
+#endif
+    }
+
+private:
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+    const mkldnn_threadpool_t *saved_;
+#endif
+};
+
 }
 }
 
+#include "mkldnn_thread_parallel_nd.hpp"
+
 #endif
 
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
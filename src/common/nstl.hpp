@@ -21,6 +21,7 @@
 #include <limits.h>
 #include <float.h>
 
+#include <new>
 #include <vector>
 #include <map>
 
@@ -104,13 +105,38 @@ enum nstl_status_t {
     out_of_memory
 };
 
+// std::allocator ignores over-alignment (e.g. the alignas(64) buffers in
+// primitive attributes) prior to C++17, hence the elements are allocated the
+// same way as the c_compatible objects are.
+template <typename T> struct aligned_allocator_t {
+    typedef T value_type;
+
+    aligned_allocator_t() {}
+    template <typename U> aligned_allocator_t(const aligned_allocator_t<U> &)
+    {}
+
+    T *allocate(size_t n) {
+        T *ptr = (T *)impl::malloc(n * sizeof(T),
+                c_compatible::default_alignment);
+        if (ptr == nullptr) throw std::bad_alloc();
+        return ptr;
+    }
+    void deallocate(T *ptr, size_t) { impl::free(ptr); }
+
+    template <typename U>
+    bool operator==(const aligned_allocator_t<U> &) const { return true; }
+    template <typename U>
+    bool operator!=(const aligned_allocator_t<U> &) const { return false; }
+};
+
 template <typename T> class vector: public c_compatible {
 private:
-    std::vector<T> _impl;
+    typedef std::vector<T, aligned_allocator_t<T>> impl_t;
+    impl_t _impl;
 public:
-    typedef typename std::vector<T>::iterator iterator;
-    typedef typename std::vector<T>::const_iterator const_iterator;
-    typedef typename std::vector<T>::size_type size_type;
+    typedef typename impl_t::iterator iterator;
+    typedef typename impl_t::const_iterator const_iterator;
+    typedef typename impl_t::size_type size_type;
     vector() {}
     vector(size_type n): _impl(n) {}
     vector(size_type n, const T &value): _impl(n, value) {}
@@ -132,6 +158,7 @@ public:
     }
     void clear() { _impl.clear(); }
     void push_back(const T& t) { _impl.push_back(t); }
+    void pop_back() { _impl.pop_back(); }
     void resize(size_type count) { _impl.resize(count); }
     void reserve(size_type count) { _impl.reserve(count); }
 };
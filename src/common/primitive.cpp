@@ -20,7 +20,10 @@
 #include "primitive_desc.hpp"
 #include "primitive.hpp"
 #include "engine.hpp"
+#include "event.hpp"
+#include "mkldnn_thread.hpp"
 #include "type_helpers.hpp"
+#include "verbose.hpp"
 
 using namespace mkldnn::impl;
 using namespace mkldnn::impl::status;
@@ -42,7 +45,17 @@ status_t mkldnn_primitive_create(primitive_t **primitive,
             return invalid_arguments;
     for (int i = 0; i < primitive_desc->n_outputs(); ++i)
         if (outputs[i] == nullptr) return invalid_arguments;
-    return primitive_desc->create_primitive(primitive, inputs, outputs);
+
+    if (mkldnn_verbose()->level < verbose_create
+            || primitive_desc->kind() == primitive_kind::memory)
+        return primitive_desc->create_primitive(primitive, inputs, outputs);
+
+    double ms = get_msec();
+    status_t status = primitive_desc->create_primitive(primitive, inputs,
+            outputs);
+    ms = get_msec() - ms;
+    if (status == success) verbose_print("create", primitive_desc, ms);
+    return status;
 }
 
 status_t mkldnn_primitive_get_primitive_desc(const primitive_t *primitive,
@@ -71,6 +84,35 @@ status_t mkldnn_primitive_get_output(const primitive_t *primitive,
     return success;
 }
 
+status_t mkldnn_primitive_set_scratchpad(primitive_t *primitive,
+        void *scratchpad) {
+    if (primitive == nullptr)
+        return invalid_arguments;
+    return primitive->set_scratchpad(scratchpad);
+}
+
+status_t mkldnn_primitive_execute(primitive_t *primitive,
+        const mkldnn_threadpool_t *threadpool) {
+    if (primitive == nullptr)
+        return invalid_arguments;
+    if (threadpool != nullptr) {
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+        if (utils::any_null(threadpool->get_num_threads,
+                    threadpool->parallel_for))
+            return invalid_arguments;
+#else
+        return unimplemented;
+#endif
+    }
+
+    threadpool_guard_t threadpool_guard(threadpool);
+    event_t e;
+    engine_t::event_vector prereq;
+    status_t status = primitive->engine()->submit(primitive, &e, prereq);
+    if (status != success) return status;
+    return e.get_state() == event_t::error ? runtime_error : success;
+}
+
 status_t mkldnn_primitive_destroy(primitive_t *primitive) {
     if (primitive != nullptr)
         delete primitive;
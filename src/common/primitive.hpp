@@ -94,6 +94,19 @@ struct mkldnn_primitive: public mkldnn::impl::c_compatible {
         return mkldnn::impl::status::invalid_arguments;
     }
 
+    /** sets the user-provided scratchpad. Applicable for primitives created
+     * with the user scratchpad mode only. The primitives that require a
+     * scratchpad must override this function, the others accept and ignore
+     * any buffer. */
+    virtual mkldnn::impl::status_t set_scratchpad(void *scratchpad) {
+        using namespace mkldnn::impl;
+        UNUSED(scratchpad);
+        if (pd_->attr()->scratchpad_mode_ != scratchpad_mode::user)
+            return status::invalid_arguments;
+        return pd_->scratchpad_size() == 0
+            ? status::success : status::unimplemented;
+    }
+
 protected:
     const mkldnn::impl::primitive_desc_t *pd_;
     input_vector inputs_;
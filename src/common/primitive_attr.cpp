@@ -103,6 +103,18 @@ status_t primitive_attr_t::set_post_ops(const post_ops_t &post_ops) {
     return success;
 }
 
+status_t primitive_attr_t::set_scratchpad_mode(
+        scratchpad_mode_t scratchpad_mode) {
+    using namespace mkldnn::impl::scratchpad_mode;
+
+    const bool ok = one_of(scratchpad_mode, library, user);
+    if (!ok)
+        return invalid_arguments;
+
+    scratchpad_mode_ = scratchpad_mode;
+    return success;
+}
+
 /* Public C API */
 
 status_t mkldnn_primitive_attr_create(primitive_attr_t **attr) {
@@ -185,6 +197,24 @@ status_t mkldnn_primitive_attr_set_post_ops(primitive_attr_t *attr,
     return attr->set_post_ops(*post_ops);
 }
 
+status_t mkldnn_primitive_attr_get_scratchpad_mode(
+        const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
+    if (any_null(attr, scratchpad_mode))
+        return invalid_arguments;
+
+    *scratchpad_mode = attr->scratchpad_mode_;
+
+    return success;
+}
+
+status_t mkldnn_primitive_attr_set_scratchpad_mode(primitive_attr_t *attr,
+        scratchpad_mode_t scratchpad_mode) {
+    if (any_null(attr))
+        return invalid_arguments;
+
+    return attr->set_scratchpad_mode(scratchpad_mode);
+}
+
 status_t mkldnn_post_ops_create(post_ops_t **post_ops) {
     if (post_ops == nullptr)
         return invalid_arguments;
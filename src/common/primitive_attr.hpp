@@ -124,11 +124,14 @@ struct mkldnn_post_ops: public mkldnn::impl::c_compatible {
 
 struct mkldnn_primitive_attr: public mkldnn::impl::c_compatible {
     mkldnn_primitive_attr()
-        : round_mode_(mkldnn::impl::round_mode::nearest) {}
+        : round_mode_(mkldnn::impl::round_mode::nearest)
+        , scratchpad_mode_(mkldnn::impl::scratchpad_mode::library) {}
 
     mkldnn_primitive_attr *clone() const
     { return new mkldnn_primitive_attr(*this); }
 
+    /* the scratchpad mode is supported by all the primitives, hence it is
+     * not taken into account here */
     bool has_default_values() const {
        return true
             && round_mode_ == mkldnn::impl::round_mode::nearest
@@ -140,8 +143,11 @@ struct mkldnn_primitive_attr: public mkldnn::impl::c_compatible {
             mkldnn::impl::round_mode_t round_mode);
     mkldnn::impl::status_t set_post_ops(
             const mkldnn::impl::post_ops_t &post_ops);
+    mkldnn::impl::status_t set_scratchpad_mode(
+            mkldnn::impl::scratchpad_mode_t scratchpad_mode);
 
     mkldnn::impl::round_mode_t round_mode_;
+    mkldnn::impl::scratchpad_mode_t scratchpad_mode_;
     mkldnn::impl::scales_t output_scales_;
     mkldnn::impl::post_ops_t post_ops_;
 };
@@ -52,6 +52,16 @@ status_t primitive_desc_t::query(query_t what, int idx, void *result) const {
 
         case query::impl_info_str: *(const char **)result = name(); break;
 
+        case query::memory_consumption_s64:
+            *(ptrdiff_t*)result = memory_consumption(); break;
+
+        case query::scratchpad_size:
+            *(size_t*)result = scratchpad_size(); break;
+
+        case query::time_estimate_f64:
+            if (time_estimate() <= 0.) return unimplemented;
+            *(double*)result = time_estimate(); break;
+
         default: return unimplemented;
     }
     return success;
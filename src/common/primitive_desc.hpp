@@ -57,6 +57,17 @@ struct mkldnn_primitive_desc: public mkldnn::impl::c_compatible {
     virtual int n_inputs() const { return 0; }
     virtual int n_outputs() const { return 0; }
 
+    /** size of the scratchpad required by the primitive (bytes) */
+    virtual size_t scratchpad_size() const { return 0; }
+
+    /** extra memory the primitive allocates or requires besides its inputs
+     * and outputs (bytes): the scratchpad and the implementation specific
+     * buffers, e.g. the workspaces of the reductions */
+    virtual size_t memory_consumption() const { return scratchpad_size(); }
+
+    /** estimated execution time (seconds), 0 if there is no cost model */
+    virtual double time_estimate() const { return 0.; }
+
     virtual mkldnn::impl::status_t query(mkldnn::impl::query_t what, int idx,
             void *result) const;
 
@@ -0,0 +1,232 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <iterator>
+#include <string.h>
+
+#include "mkldnn_thread.hpp"
+#include "primitive_desc_cache.hpp"
+#include "type_helpers.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+namespace {
+size_t get_op_desc_size(primitive_kind_t kind) {
+    using namespace primitive_kind;
+    switch (kind) {
+    case memory: return sizeof(memory_desc_t);
+    case convolution: return sizeof(convolution_desc_t);
+    case eltwise: return sizeof(eltwise_desc_t);
+    case softmax: return sizeof(softmax_desc_t);
+    case pooling: return sizeof(pooling_desc_t);
+    case lrn: return sizeof(lrn_desc_t);
+    case batch_normalization: return sizeof(batch_normalization_desc_t);
+    case inner_product: return sizeof(inner_product_desc_t);
+    case convolution_relu: return sizeof(convolution_relu_desc_t);
+    default: return 0;
+    }
+}
+
+/* FNV-1a */
+size_t hash_combine(size_t seed, const void *data, size_t size) {
+    const unsigned char *p = (const unsigned char *)data;
+    for (size_t i = 0; i < size; ++i) {
+        seed ^= p[i];
+        seed *= (size_t)1099511628211ull;
+    }
+    return seed;
+}
+
+bool attr_is_equal(const primitive_attr_t &lhs, const primitive_attr_t &rhs) {
+    const scales_t &ls = lhs.output_scales_, &rs = rhs.output_scales_;
+    bool ok = true
+        && lhs.round_mode_ == rhs.round_mode_
+        && lhs.scratchpad_mode_ == rhs.scratchpad_mode_
+        && ls.count_ == rs.count_
+        && ls.mask_ == rs.mask_
+        && utils::array_cmp(ls.scales_, rs.scales_, ls.count_)
+        && lhs.post_ops_.len_ == rhs.post_ops_.len_;
+    if (!ok) return false;
+
+    for (int idx = 0; idx < lhs.post_ops_.len_; ++idx) {
+        const auto &le = lhs.post_ops_.entry_[idx];
+        const auto &re = rhs.post_ops_.entry_[idx];
+        if (le.kind != re.kind) return false;
+        if (le.kind == primitive_kind::sum) {
+            if (le.sum.scale != re.sum.scale) return false;
+        } else if (le.kind == primitive_kind::eltwise) {
+            ok = true
+                && le.eltwise.alg == re.eltwise.alg
+                && le.eltwise.scale == re.eltwise.scale
+                && le.eltwise.alpha == re.eltwise.alpha
+                && le.eltwise.beta == re.eltwise.beta;
+            if (!ok) return false;
+        }
+    }
+    return true;
+}
+}
+
+primitive_desc_cache_t::key_t::key_t(const op_desc_t *adesc,
+        const primitive_attr_t *aattr, int aisa, int anthr)
+    : op_desc(adesc->kind), op_desc_size(get_op_desc_size(adesc->kind))
+    , attr(*aattr), isa(aisa), nthr(anthr)
+{
+    memcpy(&op_desc, adesc, op_desc_size);
+
+    hash = 14695981039346656037ull;
+    hash = hash_combine(hash, &op_desc, op_desc_size);
+    hash = hash_combine(hash, &isa, sizeof(isa));
+    hash = hash_combine(hash, &nthr, sizeof(nthr));
+    hash = hash_combine(hash, &attr.post_ops_.len_,
+            sizeof(attr.post_ops_.len_));
+    hash = hash_combine(hash, attr.output_scales_.scales_,
+            attr.output_scales_.count_ * sizeof(float));
+}
+
+bool primitive_desc_cache_t::key_t::operator==(const key_t &rhs) const {
+    return true
+        && hash == rhs.hash
+        && op_desc_size == rhs.op_desc_size
+        && isa == rhs.isa
+        && nthr == rhs.nthr
+        && memcmp(&op_desc, &rhs.op_desc, op_desc_size) == 0
+        && attr_is_equal(attr, rhs.attr);
+}
+
+primitive_desc_cache_t::key_t primitive_desc_cache_t::make_key(
+        const op_desc_t *op_desc, const primitive_attr_t *attr) {
+    /* the implementations' choices depend on the ISA in use and on the number
+     * of threads, hence both are a part of the key */
+    return key_t(op_desc, attr, isa_tag_ ? isa_tag_() : 0,
+            mkldnn_get_max_threads());
+}
+
+primitive_desc_cache_t::lru_list_t::iterator primitive_desc_cache_t::find(
+        const key_t &key) {
+    auto range = index_.equal_range(key.hash);
+    for (auto it = range.first; it != range.second; ++it)
+        if (*it->second->key == key) return it->second;
+    return entries_.end();
+}
+
+primitive_desc_t *primitive_desc_cache_t::get(const op_desc_t *op_desc,
+        const primitive_attr_t *attr) {
+    if (get_op_desc_size(op_desc->kind) == 0) return nullptr;
+
+    const key_t key = make_key(op_desc, attr);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (capacity_ == 0) return nullptr;
+
+    auto e = find(key);
+    if (e == entries_.end()) {
+        ++misses_;
+        return nullptr;
+    }
+
+    entries_.splice(entries_.begin(), entries_, e);
+    ++hits_;
+    return e->pd->clone();
+}
+
+status_t primitive_desc_cache_t::add(const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *pd) {
+    if (get_op_desc_size(op_desc->kind) == 0) return status::success;
+    if (capacity() == 0) return status::success;
+
+    key_t *key = new key_t(make_key(op_desc, attr));
+    primitive_desc_t *pd_clone = pd->clone();
+    if (utils::any_null(key, pd_clone)) {
+        delete key;
+        delete pd_clone;
+        return status::out_of_memory;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    /* the capacity might have been changed or another thread might have just
+     * added the same entry */
+    if (capacity_ == 0 || find(*key) != entries_.end()) {
+        delete key;
+        delete pd_clone;
+        return status::success;
+    }
+
+    while ((int)entries_.size() >= capacity_)
+        evict_lru();
+
+    entry_t e = { key, pd_clone };
+    entries_.push_front(e);
+    index_.insert(std::make_pair(key->hash, entries_.begin()));
+
+    return status::success;
+}
+
+void primitive_desc_cache_t::evict_lru() {
+    if (entries_.empty()) return;
+
+    auto lru = std::prev(entries_.end());
+    auto range = index_.equal_range(lru->key->hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == lru) {
+            index_.erase(it);
+            break;
+        }
+    }
+
+    delete lru->key;
+    delete lru->pd;
+    entries_.erase(lru);
+}
+
+void primitive_desc_cache_t::set_capacity(int capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = nstl::max(capacity, 0);
+    while ((int)entries_.size() > capacity_)
+        evict_lru();
+}
+
+int primitive_desc_cache_t::capacity() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+}
+
+int primitive_desc_cache_t::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int)entries_.size();
+}
+
+void primitive_desc_cache_t::get_stats(size_t *hits, size_t *misses) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (hits) *hits = hits_;
+    if (misses) *misses = misses_;
+}
+
+void primitive_desc_cache_t::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        delete it->key;
+        delete it->pd;
+    }
+    entries_.clear();
+    index_.clear();
+}
+
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef PRIMITIVE_DESC_CACHE_HPP
+#define PRIMITIVE_DESC_CACHE_HPP
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+#include "nstl.hpp"
+#include "primitive_attr.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+/** \brief A bounded LRU cache of primitive descriptors
+ *
+ * The cache maps (op_desc, attr, isa, number of threads) to the primitive
+ * descriptor the implementation list would have produced for them, so that
+ * repeated creation of identical primitive descriptors skips walking the
+ * implementation list and re-running the implementations' init().
+ *
+ * The cache owns clones of the stored primitive descriptors and always hands
+ * out clones, so the callers own the returned objects.
+ *
+ * Only primitive descriptors created without a hint are cached: the hint
+ * influences the choice made by backward implementations, but cannot be
+ * compared by value.
+ *
+ * @note
+ *   The cache is thread-safe. The entries are looked up by the hash of their
+ *   key and kept in the order of their use, so both the lookup and the
+ *   eviction take constant time.
+ */
+struct primitive_desc_cache_t: public c_compatible {
+    /** returns an engine-specific tag (e.g. the ISA in use) that is made a
+     * part of the key */
+    typedef int (*isa_tag_f)();
+
+    enum { default_capacity = 1024 };
+
+    primitive_desc_cache_t(isa_tag_f isa_tag = nullptr)
+        : capacity_(default_capacity), hits_(0), misses_(0)
+        , isa_tag_(isa_tag) {}
+    ~primitive_desc_cache_t() { clear(); }
+
+    /** returns a clone of the cached primitive descriptor or @c nullptr if
+     * there is no matching entry */
+    primitive_desc_t *get(const op_desc_t *op_desc,
+            const primitive_attr_t *attr);
+
+    /** puts a clone of @p pd to the cache, evicting the least recently used
+     * entry if the cache is full */
+    status_t add(const op_desc_t *op_desc, const primitive_attr_t *attr,
+            const primitive_desc_t *pd);
+
+    /** sets the maximal number of entries, 0 disables the cache */
+    void set_capacity(int capacity);
+    int capacity();
+
+    int size();
+    void get_stats(size_t *hits, size_t *misses);
+
+    void clear();
+
+    /** the key of an entry, op_desc_size is 0 for the operations that are
+     * not cached */
+    struct key_t: public c_compatible {
+        op_desc_t op_desc;
+        size_t op_desc_size;
+        primitive_attr_t attr;
+        int isa;
+        int nthr;
+        size_t hash;
+
+        key_t(const op_desc_t *op_desc, const primitive_attr_t *attr,
+                int isa, int nthr);
+        bool operator==(const key_t &rhs) const;
+    };
+
+private:
+    /* keys are allocated separately as they contain over-aligned attributes
+     * that cannot be stored in a standard container */
+    struct entry_t {
+        key_t *key;
+        primitive_desc_t *pd;
+    };
+    /* the most recently used entry goes first */
+    typedef std::list<entry_t> lru_list_t;
+    typedef std::unordered_multimap<size_t, lru_list_t::iterator> index_t;
+
+    key_t make_key(const op_desc_t *op_desc, const primitive_attr_t *attr);
+    lru_list_t::iterator find(const key_t &key);
+    void evict_lru();
+
+    /* guarded by mutex_ */
+    int capacity_;
+    size_t hits_, misses_;
+    lru_list_t entries_;
+    index_t index_;
+
+    isa_tag_f isa_tag_;
+    std::mutex mutex_;
+
+    primitive_desc_cache_t(const primitive_desc_cache_t &) = delete;
+    primitive_desc_cache_t &operator=(const primitive_desc_cache_t &) = delete;
+};
+
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,233 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "engine.hpp"
+#include "event.hpp"
+#include "memory_pd.hpp"
+#include "mkldnn_thread.hpp"
+#include "primitive.hpp"
+#include "primitive_desc_tuner.hpp"
+#include "verbose.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+namespace {
+/* the memory primitives a measured implementation is executed on */
+struct scratch_memory_t {
+    ~scratch_memory_t() {
+        for (size_t i = 0; i < memories_.size(); ++i)
+            delete memories_[i];
+        for (size_t i = 0; i < buffers_.size(); ++i)
+            impl::free(buffers_[i]);
+    }
+
+    void *alloc(size_t size) {
+        void *buffer = impl::malloc(nstl::max(size, (size_t)1), 64);
+        if (buffer == nullptr) return nullptr;
+        buffers_.push_back(buffer);
+        memset(buffer, 0, size);
+        return buffer;
+    }
+
+    /** returns a zeroed memory primitive for @p mpd or @c nullptr */
+    primitive_t *create(const memory_pd_t *mpd) {
+        if (mpd == nullptr) return nullptr;
+        primitive_t *memory = nullptr;
+        if (mpd->create_primitive(&memory, nullptr, nullptr) != status::success)
+            return nullptr;
+        memories_.push_back(memory);
+        void *buffer = alloc(mpd->get_size());
+        if (buffer == nullptr) return nullptr;
+        memory->set_data_handle(buffer);
+        return memory;
+    }
+
+private:
+    nstl::vector<primitive_t *> memories_;
+    nstl::vector<void *> buffers_;
+};
+}
+
+void primitive_desc_tuner_t::set_enabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+}
+
+bool primitive_desc_tuner_t::enabled() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return enabled_;
+}
+
+primitive_desc_tuner_t::key_t primitive_desc_tuner_t::make_key(
+        const op_desc_t *op_desc, const primitive_attr_t *attr) {
+    /* the fastest implementation depends on the ISA in use and on the number
+     * of threads, hence both are a part of the key */
+    return key_t(op_desc, attr, isa_tag_ ? isa_tag_() : 0,
+            mkldnn_get_max_threads());
+}
+
+primitive_desc_tuner_t::choices_t::iterator primitive_desc_tuner_t::find(
+        const key_t &key) {
+    auto range = choices_.equal_range(key.hash);
+    for (auto it = range.first; it != range.second; ++it)
+        if (*it->second.key == key) return it;
+    return choices_.end();
+}
+
+double primitive_desc_tuner_t::measure(const primitive_desc_t *pd) {
+    scratch_memory_t scratch;
+
+    nstl::vector<primitive_at_t> inputs;
+    for (int i = 0; i < pd->n_inputs(); ++i) {
+        primitive_t *memory = scratch.create(pd->input_pd(i));
+        if (memory == nullptr) return -1.;
+        inputs.push_back(primitive_at_t{ memory, 0 });
+    }
+
+    nstl::vector<const primitive_t *> outputs;
+    for (int i = 0; i < pd->n_outputs(); ++i) {
+        primitive_t *memory = scratch.create(pd->output_pd(i));
+        if (memory == nullptr) return -1.;
+        outputs.push_back(memory);
+    }
+
+    primitive_t *p = nullptr;
+    status_t status = pd->create_primitive(&p,
+            inputs.size() ? &inputs[0] : nullptr,
+            outputs.size() ? &outputs[0] : nullptr);
+    if (status != status::success) return -1.;
+
+    if (pd->attr()->scratchpad_mode_ == scratchpad_mode::user) {
+        void *scratchpad = scratch.alloc(pd->scratchpad_size());
+        if (scratchpad == nullptr || p->set_scratchpad(scratchpad)
+                != status::success) {
+            delete p;
+            return -1.;
+        }
+    }
+
+    /* the first execution warms up the caches and is not counted */
+    double best = -1.;
+    event_t e;
+    for (int run = 0; run <= nruns; ++run) {
+        e.reset();
+        double ms = get_msec();
+        p->execute(&e);
+        ms = get_msec() - ms;
+        if (e.get_state() == event_t::error) {
+            best = -1.;
+            break;
+        }
+        if (run > 0 && (best < 0 || ms < best)) best = ms;
+    }
+
+    delete p;
+    return best;
+}
+
+status_t primitive_desc_tuner_t::create(primitive_desc_t **pd,
+        const op_desc_t *op_desc, const primitive_attr_t *attr,
+        engine_t *engine) {
+    using pd_create_f = engine_t::primitive_desc_create_f;
+    const pd_create_f *impl_list = engine->get_implementation_list();
+
+    const key_t key = make_key(op_desc, attr);
+
+    std::string impl_name;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = find(key);
+        if (it != choices_.end()) impl_name = it->second.impl_name;
+    }
+
+    if (!impl_name.empty()) {
+        for (const pd_create_f *c = impl_list; *c; ++c) {
+            primitive_desc_t *candidate = nullptr;
+            if ((*c)(&candidate, op_desc, attr, engine, nullptr)
+                    != status::success)
+                continue;
+            if (impl_name == candidate->name()) {
+                *pd = candidate;
+                return status::success;
+            }
+            delete candidate;
+        }
+        /* the remembered implementation does not accept the operation
+         * anymore, measure again */
+    }
+
+    /* the implementation list order breaks the ties and is kept if none of
+     * the candidates can be measured */
+    primitive_desc_t *best = nullptr;
+    double best_time = -1.;
+    for (const pd_create_f *c = impl_list; *c; ++c) {
+        primitive_desc_t *candidate = nullptr;
+        if ((*c)(&candidate, op_desc, attr, engine, nullptr) != status::success)
+            continue;
+
+        const double time = measure(candidate);
+        const bool faster = best == nullptr
+            || (time >= 0 && (best_time < 0 || time < best_time));
+        if (faster) {
+            delete best;
+            best = candidate;
+            best_time = time;
+        } else {
+            delete candidate;
+        }
+    }
+    if (best == nullptr) return status::unimplemented;
+
+    if (best_time >= 0 && key.op_desc_size != 0) {
+        entry_t e = { new key_t(key), best->name() };
+        if (e.key == nullptr) {
+            delete best;
+            return status::out_of_memory;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = find(key);
+        if (it != choices_.end()) {
+            /* another thread has just tuned the same key */
+            delete e.key;
+        } else {
+            choices_.insert(std::make_pair(key.hash, e));
+        }
+    }
+
+    *pd = best;
+    return status::success;
+}
+
+int primitive_desc_tuner_t::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int)choices_.size();
+}
+
+void primitive_desc_tuner_t::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = choices_.begin(); it != choices_.end(); ++it)
+        delete it->second.key;
+    choices_.clear();
+}
+
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef PRIMITIVE_DESC_TUNER_HPP
+#define PRIMITIVE_DESC_TUNER_HPP
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+#include "nstl.hpp"
+#include "primitive_attr.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_desc_cache.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+/** \brief A tuner choosing the fastest implementation of an operation
+ *
+ * When the tuning is enabled, the first creation of a primitive descriptor
+ * for an (op_desc, attr, isa, number of threads) key creates every
+ * implementation that accepts the operation, executes each of them on
+ * scratch memory and remembers the name of the fastest one. The subsequent
+ * creations for the same key pick the remembered implementation without
+ * measuring.
+ *
+ * Only the primitive descriptors created without a hint are tuned, the same
+ * as only they are cached (@sa primitive_desc_cache_t).
+ *
+ * @note
+ *   The tuner is thread-safe. The measurements are done without holding the
+ *   lock, hence two threads tuning the same key at the same time both
+ *   measure and the first result stored wins.
+ */
+struct primitive_desc_tuner_t: public c_compatible {
+    typedef primitive_desc_cache_t::isa_tag_f isa_tag_f;
+
+    /** the number of the measured executions of each implementation, the
+     * fastest one counts */
+    enum { nruns = 3 };
+
+    primitive_desc_tuner_t(isa_tag_f isa_tag = nullptr)
+        : enabled_(false), isa_tag_(isa_tag) {}
+    ~primitive_desc_tuner_t() { clear(); }
+
+    void set_enabled(bool enabled);
+    bool enabled();
+
+    /** creates the primitive descriptor of the fastest implementation of
+     * @p op_desc with @p attr, tuning the choice if it is not known yet.
+     * Returns status::unimplemented if there is no implementation */
+    status_t create(primitive_desc_t **pd, const op_desc_t *op_desc,
+            const primitive_attr_t *attr, engine_t *engine);
+
+    /** the number of the remembered choices */
+    int size();
+
+    void clear();
+
+private:
+    typedef primitive_desc_cache_t::key_t key_t;
+
+    /* keys are allocated separately as they contain over-aligned attributes
+     * that cannot be stored in a standard container */
+    struct entry_t {
+        key_t *key;
+        std::string impl_name;
+    };
+    typedef std::unordered_multimap<size_t, entry_t> choices_t;
+
+    key_t make_key(const op_desc_t *op_desc, const primitive_attr_t *attr);
+
+    /* the lock must be held */
+    choices_t::iterator find(const key_t &key);
+
+    /** returns the best time (milliseconds) of @p pd executed on zeroed
+     * memory or a negative value if the primitive cannot be executed */
+    static double measure(const primitive_desc_t *pd);
+
+    /* guarded by mutex_ */
+    bool enabled_;
+    choices_t choices_;
+
+    isa_tag_f isa_tag_;
+    std::mutex mutex_;
+
+    primitive_desc_tuner_t(const primitive_desc_tuner_t &) = delete;
+    primitive_desc_tuner_t &operator=(const primitive_desc_tuner_t &) = delete;
+};
+
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
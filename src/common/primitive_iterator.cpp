@@ -21,6 +21,8 @@
 #include "c_types_map.hpp"
 #include "engine.hpp"
 #include "primitive_desc.hpp"
+#include "primitive_desc_cache.hpp"
+#include "primitive_desc_tuner.hpp"
 #include "type_helpers.hpp"
 
 using namespace mkldnn::impl;
@@ -137,13 +139,40 @@ status_t mkldnn_primitive_desc_iterator_destroy(
 status_t mkldnn_primitive_desc_create_v2(primitive_desc_t **primitive_desc,
         const_c_op_desc_t c_op_desc, const primitive_attr_t *attr,
         engine_t *engine, const primitive_desc_t *hint_fwd_pd) {
+    if (utils::any_null(primitive_desc, c_op_desc, engine))
+        return invalid_arguments;
+
     const op_desc_t *op_desc = (const op_desc_t *)c_op_desc;
+    const primitive_attr_t default_attr;
+    if (attr == nullptr) attr = &default_attr;
+
+    /* hint affects the choice of an implementation, but cannot be compared
+     * by value, hence primitive descriptors with hints are never cached */
+    primitive_desc_cache_t *cache = hint_fwd_pd == nullptr
+        ? engine->pd_cache() : nullptr;
+    if (cache) {
+        primitive_desc_t *pd = cache->get(op_desc, attr);
+        if (pd != nullptr) {
+            *primitive_desc = pd;
+            return success;
+        }
+    }
 
-    mkldnn_primitive_desc_iterator it(engine, op_desc, attr, hint_fwd_pd);
-    ++it;
-    if (it == it.end()) return unimplemented;
+    status_t status = success;
+    primitive_desc_tuner_t *tuner = hint_fwd_pd == nullptr
+        ? engine->pd_tuner() : nullptr;
+    if (tuner && tuner->enabled()) {
+        status = tuner->create(primitive_desc, op_desc, attr, engine);
+    } else {
+        mkldnn_primitive_desc_iterator it(engine, op_desc, attr, hint_fwd_pd);
+        ++it;
+        if (it == it.end()) return unimplemented;
+        status = safe_ptr_assign<primitive_desc_t>(*primitive_desc, *it);
+    }
 
-    return safe_ptr_assign<primitive_desc_t>(*primitive_desc, *it);
+    if (status == success && cache)
+        cache->add(op_desc, attr, *primitive_desc);
+    return status;
 }
 
 status_t mkldnn_primitive_desc_create(primitive_desc_t **primitive_desc,
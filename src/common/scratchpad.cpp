@@ -52,39 +52,58 @@ private:
 */
 
 struct global_scratchpad_t : public scratchpad_t {
-    global_scratchpad_t(size_t size) {
-        if (size > size_) {
-            if (scratchpad_ != nullptr) free(scratchpad_);
-            size_ = size;
-            scratchpad_ = (char *) malloc(size, page_size);
-            assert(scratchpad_ != nullptr);
-        }
+    global_scratchpad_t(size_t size): size_(size) {
+        buffer_.reserve(size);
         reference_count_++;
     }
 
     ~global_scratchpad_t() {
         reference_count_--;
-        if (reference_count_ == 0) {
-            free(scratchpad_);
-            scratchpad_ = nullptr;
-            size_ = 0;
-        }
+        if (reference_count_ == 0)
+            buffer_.release();
     }
 
+    /* the primitive may be executed by a thread other than the one that
+     * created it (e.g. by a worker of an asynchronous stream), hence the
+     * buffer of the executing thread is grown on demand */
     virtual char *get() const {
-        return scratchpad_;
+        return buffer_.reserve(size_);
     }
 
 private:
-    static char *scratchpad_;
-    static size_t size_;
-    static unsigned int reference_count_;
-#pragma omp threadprivate(scratchpad_, size_, reference_count_)
+    struct buffer_t {
+        buffer_t(): scratchpad_(nullptr), size_(0) {}
+        ~buffer_t() { release(); }
+
+        char *reserve(size_t size) {
+            if (size > size_) {
+                if (scratchpad_ != nullptr) free(scratchpad_);
+                size_ = size;
+                scratchpad_ = (char *) malloc(size, page_size);
+                assert(scratchpad_ != nullptr);
+            }
+            return scratchpad_;
+        }
+
+        void release() {
+            free(scratchpad_);
+            scratchpad_ = nullptr;
+            size_ = 0;
+        }
+
+    private:
+        char *scratchpad_;
+        size_t size_;
+    };
+
+    size_t size_;
+
+    thread_local static buffer_t buffer_;
+    thread_local static unsigned int reference_count_;
 };
 
-char *global_scratchpad_t::scratchpad_ = nullptr;
-size_t global_scratchpad_t::size_ = 0;
-unsigned int global_scratchpad_t::reference_count_ = 0;
+thread_local global_scratchpad_t::buffer_t global_scratchpad_t::buffer_;
+thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
 
 /*
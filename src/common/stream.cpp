@@ -15,10 +15,17 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "mkldnn.h"
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "memory_pd.hpp"
+#include "mkldnn_thread.hpp"
 #include "nstl.hpp"
 #include "stream.hpp"
 #include "type_helpers.hpp"
@@ -46,6 +53,7 @@ status_t stream_t::submit(const nstl::vector<primitive_t *> &prims,
 
     const size_t start = stream_.size();
     stream_.insert(stream_.end(), prims.begin(), prims.end());
+    threadpool_guard_t threadpool_guard(threadpool());
     return submit_impl(start, stream_.size(), error_prim);
 }
 
@@ -53,16 +61,21 @@ bool stream_t::closed() const { return true; }
 
 bool stream_t::closed(const primitive_vector &prims) const { return true; }
 
-status_t stream_t::wait(primitive_t **error_prim) {
+status_t stream_t::wait(primitive_t **error_prim, bool block) {
     if (!closed()) return invalid_arguments; /* XXX: redundant? */
 
     primitive_t *error_primitive_stub;
     if (error_prim == nullptr) error_prim = &error_primitive_stub;
 
-    modifiable_ = false;
     state_ = stream_t::waiting;
-    status_t status = wait_impl(error_prim);
-    state_ = stream_t::stopped;
+    threadpool_guard_t threadpool_guard(threadpool());
+    status_t status = wait_impl(error_prim, block);
+    /* a non-blocking wait that returns try_again is not complete, hence the
+     * stream stays modifiable */
+    if (status != try_again) {
+        modifiable_ = false;
+        state_ = stream_t::stopped;
+    }
     return status;
 }
 
@@ -73,25 +86,313 @@ status_t stream_t::rerun(primitive_t **error_prim) {
     if (error_prim == nullptr) error_prim = &error_primitive_stub;
 
     state_ = stream_t::running;
+    threadpool_guard_t threadpool_guard(threadpool());
     return rerun_impl(error_prim);
 }
 
+/* asynchronous eager stream */
+
+namespace mkldnn {
+namespace impl {
+
+memory_range_t memory_range(const primitive_t *p) {
+    memory_range_t range = { nullptr, nullptr };
+    if (p->kind() != primitive_kind::memory) return range;
+
+    void *handle = nullptr;
+    p->get_data_handle(&handle);
+    range.begin = (const char *)handle;
+    range.end = range.begin
+        + static_cast<const memory_pd_t *>(p->pd())->get_size();
+    return range;
+}
+
+namespace {
+/* executes @p f on at most @p nthr threads of the calling worker */
+template <typename F>
+void execute_on_team(int nthr, const F &f) {
+#if MKLDNN_THR == MKLDNN_THR_OMP
+    omp_set_num_threads(nthr);
+    f();
+#elif MKLDNN_THR == MKLDNN_THR_TBB
+    tbb::task_arena arena(nthr);
+    arena.execute(f);
+#else
+    UNUSED(nthr);
+    f();
+#endif
+}
+
+/* the maximal number of primitives executed concurrently by a stream */
+int max_teams(int max_threads) {
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+    /* the user threadpool is not required to accept the work from several
+     * threads at once */
+    UNUSED(max_threads);
+    return 1;
+#else
+    const int max_branches = 4;
+    return nstl::max(1, nstl::min(max_branches, max_threads));
+#endif
+}
+}
+
+struct stream_eager_async_t::node_t: public c_compatible {
+    node_t(primitive_t *p): p(p), n_deps(0), aborted(false), done(false) {
+        for (size_t i = 0; i < p->inputs().size(); ++i) {
+            const primitive_at_t &in = p->inputs()[i];
+            const primitive_t *m = in.primitive->kind() == primitive_kind::memory
+                ? in.primitive : in.primitive->outputs()[in.output_index];
+            reads.push_back(memory_range(m));
+        }
+        for (size_t o = 0; o < p->outputs().size(); ++o)
+            writes.push_back(memory_range(p->outputs()[o]));
+
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+        threadpool = threadpool_utils::get_active_threadpool();
+#endif
+        max_threads = mkldnn_get_max_threads();
+    }
+
+    /** returns true if the node must wait for the earlier node @p prev */
+    bool depends_on(const node_t *prev) const {
+        if (p == prev->p) return true;
+        for (size_t w = 0; w < prev->writes.size(); ++w) {
+            for (size_t r = 0; r < reads.size(); ++r)
+                if (prev->writes[w].intersects(reads[r])) return true;
+            for (size_t o = 0; o < writes.size(); ++o)
+                if (prev->writes[w].intersects(writes[o])) return true;
+        }
+        for (size_t r = 0; r < prev->reads.size(); ++r)
+            for (size_t o = 0; o < writes.size(); ++o)
+                if (prev->reads[r].intersects(writes[o])) return true;
+        return false;
+    }
+
+    primitive_t *p;
+    event_t e;
+    nstl::vector<memory_range_t> reads, writes;
+    int max_threads;
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+    const mkldnn_threadpool_t *threadpool;
+#endif
+
+    /* guarded by scheduler_t::mutex */
+    nstl::vector<node_t *> dependents;
+    int n_deps;
+    bool aborted;
+    bool done;
+};
+
+struct stream_eager_async_t::scheduler_t: public c_compatible {
+    scheduler_t(): n_pending_(0), n_running_(0), stop_(false) {}
+
+    ~scheduler_t() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [&]() { return n_pending_ == 0; });
+            stop_ = true;
+        }
+        work_.notify_all();
+        for (size_t i = 0; i < workers_.size(); ++i)
+            workers_[i].join();
+        for (size_t i = 0; i < nodes_.size(); ++i)
+            delete nodes_[i];
+    }
+
+    void submit(primitive_t *p) {
+        node_t *node = new node_t(p);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < nodes_.size(); ++i) {
+            node_t *prev = nodes_[i];
+            if (!prev->done && node->depends_on(prev)) {
+                prev->dependents.push_back(node);
+                ++node->n_deps;
+            }
+        }
+        nodes_.push_back(node);
+        ++n_pending_;
+
+        const int n_teams = max_teams(node->max_threads);
+        while ((int)workers_.size() < n_teams)
+            workers_.emplace_back([this]() { work(); });
+
+        if (node->n_deps == 0) {
+            ready_.push_back(node);
+            work_.notify_one();
+        }
+    }
+
+    /** returns true if all the submitted primitives are done */
+    bool wait(bool block) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (block)
+            done_.wait(lock, [&]() { return n_pending_ == 0; });
+        return n_pending_ == 0;
+    }
+
+    /* the primitives must be done */
+    const nstl::vector<node_t *> &nodes() const { return nodes_; }
+
+    /** waits until the workers are done with the submitted primitives and
+     * forgets them */
+    void clear() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&]() { return n_pending_ == 0; });
+        for (size_t i = 0; i < nodes_.size(); ++i)
+            delete nodes_[i];
+        nodes_.clear();
+    }
+
+private:
+    /* returns a node that can be started now or nullptr if none */
+    node_t *pop_ready() {
+        if (ready_.empty()) return nullptr;
+        node_t *node = ready_.front();
+        ready_.pop_front();
+        return node;
+    }
+
+    void execute(node_t *node, int nthr) {
+        if (node->aborted) {
+            node->e.set_state(event_t::aborted);
+            return;
+        }
+
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+        threadpool_utils::activate_threadpool(node->threadpool);
+#endif
+        execute_on_team(nthr, [&]() {
+            engine_t::event_vector prereq;
+            status_t status = node->p->engine()->submit(node->p, &node->e,
+                    prereq);
+            if (status != success) node->e.set_state(event_t::error);
+        });
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+        threadpool_utils::activate_threadpool(nullptr);
+#endif
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            node_t *node = nullptr;
+            work_.wait(lock, [&]() {
+                return stop_ || (node = pop_ready()) != nullptr;
+            });
+            if (node == nullptr) break;
+
+            /* the threads are split evenly among the running primitives */
+            ++n_running_;
+            const int n_active = nstl::min(max_teams(node->max_threads),
+                    n_running_ + (int)ready_.size());
+            const int nthr = nstl::max(1, node->max_threads / n_active);
+
+            lock.unlock();
+            execute(node, nthr);
+            lock.lock();
+
+            --n_running_;
+            node->done = true;
+            const bool failed = node->e.get_state() != event_t::ready;
+            for (size_t i = 0; i < node->dependents.size(); ++i) {
+                node_t *dep = node->dependents[i];
+                dep->aborted = dep->aborted || failed;
+                if (--dep->n_deps == 0) ready_.push_back(dep);
+            }
+            node->dependents.clear();
+
+            if (--n_pending_ == 0) done_.notify_all();
+            work_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable work_, done_;
+    std::vector<std::thread> workers_;
+
+    nstl::vector<node_t *> nodes_;
+    std::deque<node_t *> ready_;
+    int n_pending_, n_running_;
+    bool stop_;
+};
+
+stream_eager_async_t::stream_eager_async_t(): scheduler_(new scheduler_t) {}
+
+stream_eager_async_t::~stream_eager_async_t() { delete scheduler_; }
+
+status_t stream_eager_async_t::submit_impl(size_t begin, size_t end,
+        primitive_t **error_prim) {
+    UNUSED(error_prim);
+    for (size_t p_index = begin; p_index < end; ++p_index)
+        scheduler_->submit(stream_[p_index]);
+    return success;
+}
+
+status_t stream_eager_async_t::wait_impl(primitive_t **error_prim,
+        bool block) {
+    if (!scheduler_->wait(block)) return try_again;
+
+    /* error handling */
+    const nstl::vector<node_t *> &nodes = scheduler_->nodes();
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i]->e.get_state() == event_t::error) {
+            *error_prim = nodes[i]->p;
+            return runtime_error;
+        }
+    }
+
+    return success;
+}
+
+status_t stream_eager_async_t::rerun_impl(primitive_t **error_prim) {
+    /* the data handles might have changed, hence the dependencies are
+     * rebuilt from scratch */
+    scheduler_->clear();
+    return submit_impl(0, stream_.size(), error_prim);
+}
+
+}
+}
+
 /* API */
 
 status_t mkldnn_stream_create(stream_t **stream, stream_kind_t stream_kind) {
     bool args_ok = stream != nullptr && utils::one_of(stream_kind,
-            stream_kind::eager, stream_kind::lazy);
+            stream_kind::eager, stream_kind::lazy, stream_kind::eager_async);
     if (!args_ok)
         return invalid_arguments;
 
     stream_t *s;
     if (stream_kind == stream_kind::eager)
         s = new stream_eager_t;
+    else if (stream_kind == stream_kind::eager_async)
+        s = new stream_eager_async_t;
     else
         s = new stream_lazy_t;
     return safe_ptr_assign<stream_t>(*stream, s);
 }
 
+status_t mkldnn_stream_create_with_threadpool(stream_t **stream,
+        stream_kind_t stream_kind, const mkldnn_threadpool_t *threadpool) {
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+    bool args_ok = threadpool != nullptr
+        && !utils::any_null(threadpool->get_num_threads,
+                threadpool->parallel_for);
+    if (!args_ok)
+        return invalid_arguments;
+
+    status_t status = mkldnn_stream_create(stream, stream_kind);
+    if (status == success)
+        (*stream)->set_threadpool(*threadpool);
+    return status;
+#else
+    UNUSED(stream); UNUSED(stream_kind); UNUSED(threadpool);
+    return unimplemented;
+#endif
+}
+
 status_t mkldnn_stream_submit(stream_t *stream, size_t n,
         primitive_t *primitives[], primitive_t **error_primitive) {
     bool args_ok = !utils::any_null(stream, primitives);
@@ -107,9 +408,8 @@ status_t mkldnn_stream_submit(stream_t *stream, size_t n,
 
 status_t mkldnn_stream_wait(stream_t *stream, int block,
         primitive_t **error_primitive) {
-    UNUSED(block);
     if (stream == nullptr) return invalid_arguments;
-    return stream->wait(error_primitive);
+    return stream->wait(error_primitive, block != 0);
 }
 
 status_t mkldnn_stream_rerun(stream_t *stream, primitive_t **error_primitive) {
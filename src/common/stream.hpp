@@ -72,9 +72,19 @@ struct mkldnn_stream: public mkldnn::impl::c_compatible {
 #endif
     };
 
-    mkldnn_stream(): modifiable_(true), state_(mkldnn_stream::running) {}
+    mkldnn_stream(): modifiable_(true), state_(mkldnn_stream::running)
+        , threadpool_() {}
     virtual ~mkldnn_stream() {}
 
+    /** sets the user-provided threadpool the primitives are executed on */
+    void set_threadpool(const mkldnn_threadpool_t &threadpool)
+    { threadpool_ = threadpool; }
+
+    /** returns the threadpool the primitives are executed on or @c nullptr if
+     * the library threads are used */
+    const mkldnn_threadpool_t *threadpool() const
+    { return threadpool_.parallel_for ? &threadpool_ : nullptr; }
+
     /** submits vector of primitives @p prims to a stream
      *
      * @param prims (input)
@@ -136,12 +146,14 @@ struct mkldnn_stream: public mkldnn::impl::c_compatible {
      *
      * A high level function which is responsible for stream consistency and
      * setting state_ to @c waiting. Implementation specific stuff happens in
-     * wait_impl() */
-    mkldnn::impl::status_t wait(mkldnn::impl::primitive_t **error_prim);
+     * wait_impl(). If @p block is @c false and the computations are still in
+     * progress returns status::try_again */
+    mkldnn::impl::status_t wait(mkldnn::impl::primitive_t **error_prim,
+            bool block = true);
 
     /** implementation specific wait */
     virtual mkldnn::impl::status_t wait_impl(
-            mkldnn::impl::primitive_t **error_prim) = 0;
+            mkldnn::impl::primitive_t **error_prim, bool block) = 0;
 
     /** re-runs stream
      *
@@ -159,11 +171,25 @@ protected:
     state_t state_;
 
     primitive_vector stream_;
+    mkldnn_threadpool_t threadpool_;
 };
 
 namespace mkldnn {
 namespace impl {
 
+/** the memory [begin, end) held by a memory primitive, empty for the other
+ * primitives */
+struct memory_range_t {
+    const char *begin, *end;
+
+    bool intersects(const memory_range_t &rhs) const {
+        if (begin == nullptr || rhs.begin == nullptr) return false;
+        return begin == rhs.begin || (begin < rhs.end && rhs.begin < end);
+    }
+};
+
+memory_range_t memory_range(const primitive_t *p);
+
 struct stream_lazy_t;
 
 /** \brief non-lazy stream */
@@ -199,15 +225,10 @@ struct stream_eager_t: public stream_t {
         return status::success;
     }
 
-    virtual status_t wait_impl(primitive_t **error_prim) {
-        /* wait until all done */
-        while (1) {
-            bool execution_done = true;
-            for (auto it = deps_.begin(); it != deps_.end(); ++it) {
-                if (!it->second.finished()) execution_done = false;
-            }
-            if (execution_done) break;
-        }
+    virtual status_t wait_impl(primitive_t **error_prim, bool block) {
+        /* the primitives are executed at the submission, hence there is
+         * nothing to wait for whatever @p block is */
+        UNUSED(block);
 
         /* error handling */
         for (auto it = deps_.begin(); it != deps_.end(); ++it) {
@@ -232,6 +253,30 @@ protected:
     nstl::map<const primitive_t *, event_t> deps_;
 };
 
+/** \brief asynchronous non-lazy stream
+ *
+ * The primitives are executed asynchronously w.r.t. the user thread by a team
+ * of workers owned by the stream. A primitive is started as soon as all the
+ * primitives submitted earlier it depends on are done, i.e. the ones that
+ * write to the memory it reads or writes, or read the memory it writes. The
+ * independent primitives (e.g. the branches of inception-like topologies)
+ * are executed concurrently, each on a subset of the threads. */
+struct stream_eager_async_t: public stream_t {
+    stream_eager_async_t();
+    virtual ~stream_eager_async_t();
+
+    virtual status_t submit_impl(size_t begin, size_t end,
+            primitive_t **error_prim);
+    virtual status_t wait_impl(primitive_t **error_prim, bool block);
+    virtual status_t rerun_impl(primitive_t **error_prim);
+
+protected:
+    struct node_t;
+    struct scheduler_t;
+
+    scheduler_t *scheduler_;
+};
+
 /** \brief lazy stream
  *
  * @attention
@@ -241,15 +286,25 @@ protected:
  *     guaranteed that the pointer will be valid till the stream is alive
  */
 struct stream_lazy_t: public stream_t {
-    virtual status_t wait_impl(primitive_t **error_prim) {
-        stream_eager_.stream_ = stream_;
-#if 0
-        for_each (aengine in stream_) {
-            aengine->optimize(stream_eager_.stream_); /* in-place operation */
+    stream_lazy_t(): submitted_(false), arena_(nullptr) {}
+    virtual ~stream_lazy_t() {
+        for (size_t i = 0; i < fused_.size(); ++i)
+            delete fused_[i];
+        impl::free(arena_);
+    }
+
+    virtual status_t wait_impl(primitive_t **error_prim, bool block) {
+        if (!submitted_) {
+            primitive_vector prims;
+            status_t status = optimize(prims);
+            if (status != status::success) return status;
+            status = plan_memory(prims);
+            if (status != status::success) return status;
+            status = stream_eager_.submit(prims, error_prim);
+            if (status != status::success) return status;
+            submitted_ = true;
         }
-#endif
-        stream_eager_.submit(stream_eager_.stream_, error_prim);
-        return stream_eager_.wait_impl(error_prim);
+        return stream_eager_.wait(error_prim, block);
     }
 
     virtual status_t rerun_impl(primitive_t **error_prim) {
@@ -257,7 +312,31 @@ struct stream_lazy_t: public stream_t {
     }
 
 protected:
+    /** rewrites stream_ into @p prims, which computes the same outputs:
+     *  - a convolution followed by a relu or by an in-place sum is fused
+     *    into the convolution with the corresponding post-op,
+     *  - a batch normalization followed by a relu is fused into the batch
+     *    normalization with the relu post-op,
+     *  - a pair of back-to-back reorders is replaced with a single reorder,
+     *    or dropped if the second one restores the source of the first.
+     *
+     * The memory passed only between the fused primitives is not written.
+     * The primitives created are owned by the stream (fused_). */
+    status_t optimize(primitive_vector &prims);
+
+    /** places the memory primitives of @p prims that have no data handle
+     * (the intermediates owned by the stream) into arena_. The memories
+     * that are never live at the same time share the storage; a memory
+     * that is not read after its last write is an output of the stream and
+     * is kept till the stream is destroyed */
+    status_t plan_memory(const primitive_vector &prims);
+
     stream_eager_t stream_eager_;
+    /** whether stream_ was passed to stream_eager_ (once, at the first
+     * wait) */
+    bool submitted_;
+    primitive_vector fused_;
+    char *arena_;
 };
 
 }
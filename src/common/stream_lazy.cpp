@@ -0,0 +1,407 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "memory_pd.hpp"
+#include "nstl.hpp"
+#include "primitive_desc.hpp"
+#include "reorder_pd.hpp"
+#include "stream.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+using namespace mkldnn::impl::status;
+using namespace mkldnn::impl::types;
+
+namespace {
+typedef stream_t::primitive_vector primitive_vector;
+
+/* the memory primitive @p in refers to */
+const primitive_t *memory_of(const primitive_at_t &in) {
+    return in.primitive->kind() == primitive_kind::memory
+        ? in.primitive : in.primitive->outputs()[in.output_index];
+}
+
+const memory_desc_t *md_of(const primitive_t *m) {
+    return static_cast<const memory_pd_t *>(m->pd())->desc();
+}
+
+/* the primitives whose inputs and outputs are all memory primitives (not
+ * views) can be analyzed */
+bool is_analyzable(const primitive_t *p) {
+    for (size_t i = 0; i < p->inputs().size(); ++i)
+        if (memory_of(p->inputs()[i])->kind() != primitive_kind::memory)
+            return false;
+    for (size_t o = 0; o < p->outputs().size(); ++o)
+        if (p->outputs()[o]->kind() != primitive_kind::memory)
+            return false;
+    return true;
+}
+
+/* the memory without a data handle is an intermediate the stream allocates
+ * (see plan_memory()) */
+bool is_unallocated(const primitive_t *m) {
+    return m->kind() == primitive_kind::memory
+        && memory_range(m).begin == nullptr;
+}
+
+bool overlaps(const primitive_t *lhs, const primitive_t *rhs) {
+    if (is_unallocated(lhs) || is_unallocated(rhs)) return lhs == rhs;
+    return memory_range(lhs).intersects(memory_range(rhs));
+}
+
+bool reads(const primitive_t *p, const primitive_t *m) {
+    for (size_t i = 0; i < p->inputs().size(); ++i)
+        if (overlaps(memory_of(p->inputs()[i]), m)) return true;
+    return false;
+}
+
+bool writes(const primitive_t *p, const primitive_t *m) {
+    for (size_t o = 0; o < p->outputs().size(); ++o)
+        if (overlaps(p->outputs()[o], m)) return true;
+    return false;
+}
+
+/* whether @p lhs and @p rhs are the same memory (the same buffer and the
+ * same layout) */
+bool is_same_memory(const primitive_t *lhs, const primitive_t *rhs) {
+    if (is_unallocated(lhs) || is_unallocated(rhs)) return lhs == rhs;
+    return memory_range(lhs).begin == memory_range(rhs).begin
+        && *md_of(lhs) == *md_of(rhs);
+}
+
+/* returns the index of the input of @p p that is @p m, -1 if none */
+int input_index(const primitive_t *p, const primitive_t *m) {
+    for (size_t i = 0; i < p->inputs().size(); ++i)
+        if (is_same_memory(memory_of(p->inputs()[i]), m)) return (int)i;
+    return -1;
+}
+
+bool is_relu_inference(const primitive_t *p) {
+    if (p->kind() != primitive_kind::eltwise) return false;
+    auto desc = (const eltwise_desc_t *)p->pd()->op_desc();
+    return desc->prop_kind == prop_kind::forward_inference
+        && desc->alg_kind == alg_kind::eltwise_relu;
+}
+
+bool is_fwd(prop_kind_t prop_kind) {
+    return utils::one_of(prop_kind, prop_kind::forward_training,
+            prop_kind::forward_inference);
+}
+
+/* creates a primitive doing the same as @p p with the attributes @p attr,
+ * that writes its first output to @p dst. Only the implementations using
+ * the same memory formats as @p p are considered */
+status_t create_with_attr(const primitive_t *p, const primitive_attr_t &attr,
+        const primitive_t *dst, primitive_t **fused) {
+    const primitive_desc_t *p_pd = p->pd();
+    engine_t *engine = p_pd->engine();
+
+    for (auto impl = engine->get_implementation_list(); *impl; ++impl) {
+        primitive_desc_t *pd;
+        if ((*impl)(&pd, p_pd->op_desc(), &attr, engine, nullptr) != success)
+            continue;
+
+        bool ok = *pd->output_pd(0)->desc() == *md_of(dst);
+        for (int i = 0; i < p_pd->n_inputs(); ++i)
+            ok = ok && *pd->input_pd(i)->desc() == *p_pd->input_pd(i)->desc();
+        for (int o = 1; o < p_pd->n_outputs(); ++o)
+            ok = ok
+                && *pd->output_pd(o)->desc() == *p_pd->output_pd(o)->desc();
+
+        status_t status = unimplemented;
+        if (ok) {
+            nstl::vector<const primitive_t *> outputs(p->outputs().begin(),
+                    p->outputs().end());
+            outputs[0] = dst;
+            status = pd->create_primitive(fused, &p->inputs()[0],
+                    &outputs[0]);
+        }
+        delete pd;
+        if (ok) return status;
+    }
+
+    return unimplemented;
+}
+
+/* the result of fusing a producer with its consumer */
+struct fusion_t {
+    fusion_t(): fused(nullptr), elide(false) {}
+    primitive_t *fused; /**< replaces the consumer, nullptr if none */
+    bool elide; /**< both the producer and the consumer are dropped */
+};
+
+/* conv -> relu, conv -> sum (in-place), bnorm -> relu, reorder -> reorder */
+status_t fuse(const primitive_t *p, const primitive_t *c, fusion_t &fusion) {
+    const primitive_t *m = p->outputs()[0];
+    const primitive_t *c_dst = c->outputs()[0];
+    primitive_attr_t attr = *p->pd()->attr();
+
+    switch (p->kind()) {
+    case primitive_kind::convolution: {
+        auto desc = (const convolution_desc_t *)p->pd()->op_desc();
+        if (!is_fwd(desc->prop_kind)) return success;
+
+        if (is_relu_inference(c)) {
+            auto c_desc = (const eltwise_desc_t *)c->pd()->op_desc();
+            if (attr.post_ops_.append_eltwise(1.f, alg_kind::eltwise_relu,
+                        c_desc->alpha, 0.f) != success)
+                return success;
+        } else if (c->kind() == primitive_kind::sum) {
+            /* dst = conv + dst, i.e. the other summand is the destination
+             * of the sum. The jit kernels accumulate into the destination
+             * as is, hence only the unit scales are fused */
+            auto c_pd = (const sum_pd_t *)c->pd();
+            const int m_idx = input_index(c, m);
+            if (c_pd->n_inputs() != 2) return success;
+            const int d_idx = 1 - m_idx;
+            bool ok = true
+                && utils::everyone_is(1.f, c_pd->scale(m_idx),
+                        c_pd->scale(d_idx))
+                && attr.post_ops_.len_ == 0
+                && is_same_memory(memory_of(c->inputs()[d_idx]), c_dst)
+                && attr.post_ops_.append_sum(1.f) == success;
+            if (!ok) return success;
+        } else {
+            return success;
+        }
+        break;
+    }
+    case primitive_kind::batch_normalization: {
+        auto desc = (const batch_normalization_desc_t *)p->pd()->op_desc();
+        bool ok = true
+            && desc->prop_kind == prop_kind::forward_inference
+            && attr.post_ops_.len_ == 0
+            && is_relu_inference(c)
+            && ((const eltwise_desc_t *)c->pd()->op_desc())->alpha == 0.f
+            && attr.post_ops_.append_eltwise(1.f, alg_kind::eltwise_relu,
+                    0.f, 0.f) == success;
+        if (!ok) return success;
+        break;
+    }
+    case primitive_kind::reorder: {
+        /* only the layout changes: both reorders are exact */
+        const primitive_t *src = memory_of(p->inputs()[0]);
+        bool ok = true
+            && c->kind() == primitive_kind::reorder
+            && p->pd()->attr()->has_default_values()
+            && c->pd()->attr()->has_default_values()
+            && utils::everyone_is(md_of(src)->data_type,
+                    md_of(m)->data_type, md_of(c_dst)->data_type);
+        if (!ok) return success;
+
+        if (is_same_memory(src, c_dst)) {
+            fusion.elide = true;
+            return success;
+        }
+
+        engine_t *engine = p->pd()->engine();
+        auto src_pd = (const memory_pd_t *)src->pd();
+        auto dst_pd = (const memory_pd_t *)c_dst->pd();
+        for (auto r = engine->get_reorder_implementation_list(); *r; ++r) {
+            reorder_pd_t *r_pd;
+            if ((*r)(&r_pd, src_pd, dst_pd, &attr) != success) continue;
+            status_t status = r_pd->create_primitive(&fusion.fused,
+                    &p->inputs()[0], &c_dst);
+            delete r_pd;
+            return status;
+        }
+        return success;
+    }
+    default: return success;
+    }
+
+    status_t status = create_with_attr(p, attr, c_dst, &fusion.fused);
+    return status == unimplemented ? success : status;
+}
+
+/* checks whether prims[i] (the producer) can be moved to prims[j] (the
+ * consumer of its first output) and merged with it */
+bool can_merge(const primitive_vector &prims, size_t i, size_t j) {
+    const primitive_t *p = prims[i], *c = prims[j];
+    if (p->outputs().size() == 0 || !is_analyzable(p) || !is_analyzable(c))
+        return false;
+
+    const primitive_t *m = p->outputs()[0];
+    if (input_index(c, m) < 0) return false;
+
+    /* the intermediate memory is not written by the merged primitive, so no
+     * one else may access it, unless the consumer overwrites it in-place */
+    const bool m_is_overwritten = writes(c, m);
+    for (size_t k = 0; k < prims.size(); ++k) {
+        if (k == i || k == j) continue;
+        const primitive_t *q = prims[k];
+        if (!is_analyzable(q)) return false;
+        const bool in_between = i < k && k < j;
+        if ((in_between || !m_is_overwritten)
+                && (reads(q, m) || writes(q, m)))
+            return false;
+        if (!in_between) continue;
+
+        /* the producer is executed later: its inputs and other outputs must
+         * not be touched in between */
+        for (size_t in = 0; in < p->inputs().size(); ++in)
+            if (writes(q, memory_of(p->inputs()[in]))) return false;
+        for (size_t o = 1; o < p->outputs().size(); ++o)
+            if (reads(q, p->outputs()[o]) || writes(q, p->outputs()[o]))
+                return false;
+    }
+
+    return true;
+}
+
+/* the lifetime of an intermediate: the indices of the first and the last
+ * primitives accessing it */
+struct buffer_t {
+    primitive_t *memory;
+    size_t size;
+    size_t first, last;
+    size_t offset;
+    bool placed;
+
+    bool is_live_with(const buffer_t &rhs) const
+    { return first <= rhs.last && rhs.first <= last; }
+};
+
+void collect_buffers(const primitive_vector &prims,
+        nstl::vector<buffer_t> &buffers) {
+    enum { alignment = 64 };
+    bool is_ordered = true;
+    for (size_t t = 0; t < prims.size(); ++t)
+        is_ordered = is_ordered && is_analyzable(prims[t]);
+
+    for (size_t t = 0; t < prims.size(); ++t) {
+        const primitive_t *p = prims[t];
+        const size_t n_inputs = p->inputs().size();
+        for (size_t a = 0; a < n_inputs + p->outputs().size(); ++a) {
+            const primitive_t *m = a < n_inputs
+                ? memory_of(p->inputs()[a]) : p->outputs()[a - n_inputs];
+            if (!is_unallocated(m)) continue;
+
+            size_t b = 0;
+            while (b < buffers.size() && buffers[b].memory != m) ++b;
+            if (b == buffers.size()) {
+                buffer_t buffer;
+                buffer.memory = const_cast<primitive_t *>(m);
+                buffer.size = utils::rnd_up(
+                        static_cast<const memory_pd_t *>(m->pd())->get_size(),
+                        (size_t)alignment);
+                buffer.first = is_ordered ? t : 0;
+                buffer.offset = 0;
+                buffer.placed = false;
+                buffers.push_back(buffer);
+            }
+
+            /* the memory not read after its last write outlives the stream
+             * (as well as any memory if the order cannot be analyzed) */
+            const bool is_input = is_ordered && a < n_inputs;
+            buffers[b].last = is_input ? t : prims.size();
+            if (is_input) continue;
+            for (size_t k = t + 1; is_ordered && k < prims.size(); ++k)
+                if (reads(prims[k], m)) { buffers[b].last = k; break; }
+        }
+    }
+}
+}
+
+status_t stream_lazy_t::plan_memory(const primitive_vector &prims) {
+    nstl::vector<buffer_t> buffers;
+    collect_buffers(prims, buffers);
+    if (buffers.size() == 0) return success;
+
+    /* the largest buffers go first, each is moved past the ones placed
+     * earlier that are live at the same time and overlap with it */
+    size_t arena_size = 0;
+    for (size_t n = 0; n < buffers.size(); ++n) {
+        size_t b = 0;
+        while (buffers[b].placed) ++b;
+        for (size_t c = b + 1; c < buffers.size(); ++c)
+            if (!buffers[c].placed && buffers[c].size > buffers[b].size)
+                b = c;
+
+        buffer_t &buffer = buffers[b];
+        bool moved = true;
+        while (moved) {
+            moved = false;
+            for (size_t c = 0; c < buffers.size(); ++c) {
+                const buffer_t &other = buffers[c];
+                bool collides = true
+                    && other.placed
+                    && buffer.is_live_with(other)
+                    && buffer.offset < other.offset + other.size
+                    && other.offset < buffer.offset + buffer.size;
+                if (collides) {
+                    buffer.offset = other.offset + other.size;
+                    moved = true;
+                }
+            }
+        }
+        buffer.placed = true;
+        arena_size = nstl::max(arena_size, buffer.offset + buffer.size);
+    }
+
+    arena_ = (char *)malloc(arena_size, 64);
+    if (arena_ == nullptr) return out_of_memory;
+    for (size_t b = 0; b < buffers.size(); ++b)
+        buffers[b].memory->set_data_handle(arena_ + buffers[b].offset);
+
+    return success;
+}
+
+status_t stream_lazy_t::optimize(primitive_vector &prims) {
+    prims = stream_;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t j = 1; j < prims.size() && !changed; ++j) {
+            for (size_t i = 0; i < j && !changed; ++i) {
+                if (!can_merge(prims, i, j)) continue;
+
+                fusion_t fusion;
+                status_t status = fuse(prims[i], prims[j], fusion);
+                if (status != success) return status;
+                if (fusion.fused == nullptr && !fusion.elide) continue;
+
+                primitive_vector optimized;
+                for (size_t k = 0; k < prims.size(); ++k) {
+                    if (k == i) continue;
+                    if (k == j) {
+                        if (fusion.fused) optimized.push_back(fusion.fused);
+                        continue;
+                    }
+                    optimized.push_back(prims[k]);
+                }
+                if (fusion.fused) fused_.push_back(fusion.fused);
+                prims = optimized;
+                changed = true;
+            }
+        }
+    }
+
+    return success;
+}
+
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
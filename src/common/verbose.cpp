@@ -0,0 +1,178 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+#include "memory_pd.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+namespace {
+int verbose_level_from_env() {
+    const char *val = getenv("MKLDNN_VERBOSE");
+    return val != nullptr ? atoi(val) : verbose_none;
+}
+
+/* the initialization of a function-local static is thread-safe */
+verbose_t &verbose() {
+    static verbose_t v(verbose_level_from_env());
+    return v;
+}
+}
+
+const verbose_t *mkldnn_verbose() { return &verbose(); }
+
+double get_msec() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(
+            steady_clock::now().time_since_epoch()).count();
+}
+
+namespace {
+#define CASE(x) case mkldnn_##x: return #x
+
+const char *prim_kind2str(primitive_kind_t kind) {
+    switch (kind) {
+    CASE(memory); CASE(view); CASE(reorder); CASE(concat);
+    CASE(concat_inplace); CASE(sum); CASE(convolution); CASE(eltwise);
+    CASE(softmax); CASE(pooling); CASE(lrn); CASE(batch_normalization);
+    CASE(inner_product); CASE(convolution_relu);
+    default: return "unknown";
+    }
+}
+
+const char *dt2str(data_type_t dt) {
+    switch (dt) {
+    CASE(f32); CASE(s32); CASE(s16); CASE(s8); CASE(u8);
+    default: return "undef";
+    }
+}
+
+const char *fmt2str(memory_format_t fmt) {
+    switch (fmt) {
+    CASE(any); CASE(blocked); CASE(x); CASE(nc); CASE(nchw); CASE(nhwc);
+    CASE(chwn); CASE(nChw8c); CASE(nChw16c); CASE(oi); CASE(io); CASE(oihw);
+    CASE(ihwo); CASE(hwio); CASE(OIhw8i8o); CASE(OIhw16i16o);
+    CASE(OIhw8i16o2i); CASE(OIhw8o16i2o); CASE(OIhw8o8i); CASE(OIhw16o16i);
+    CASE(IOhw16o16i); CASE(Oihw8o); CASE(Oihw16o); CASE(Ohwi8o);
+    CASE(Ohwi16o); CASE(OhIw16o4i); CASE(goihw); CASE(gOIhw8i8o);
+    CASE(gOIhw16i16o); CASE(gOIhw8i16o2i); CASE(gOIhw8o16i2o);
+    CASE(gOIhw8o8i); CASE(gOIhw16o16i); CASE(gIOhw16o16i); CASE(gOihw8o);
+    CASE(gOihw16o); CASE(gOhwi8o); CASE(gOhwi16o); CASE(gOhIw16o4i);
+    default: return "undef";
+    }
+}
+
+#undef CASE
+
+/* implementation names are __PRETTY_FUNCTION__ of pd_t::name(), e.g.
+ * `const char* mkldnn::impl::cpu::jit_uni_pooling_fwd_t<isa>::pd_t::name()
+ * const [with mkldnn::impl::cpu::cpu_isa_t isa = mkldnn::impl::cpu::avx2]`,
+ * so only the class name and the ISA (if any) are extracted from them, i.e.
+ * `jit_uni_pooling_fwd_t<isa>:avx2` */
+void impl_name(char *buf, size_t buf_len, const char *name) {
+    size_t len = 0;
+    auto append = [&](const char *begin, const char *end) {
+        for (const char *p = begin; p < end && len < buf_len - 1; ++p)
+            /* commas are field separators in the verbose output */
+            buf[len++] = *p == ',' ? ';' : *p;
+    };
+
+    const char *end = strstr(name, "::pd_t::name()");
+    if (end == nullptr) {
+        append(name, name + strlen(name));
+        buf[len] = '\0';
+        return;
+    }
+
+    const char *begin = name;
+    for (const char *p = name; p < end; ++p)
+        if (p[0] == ':' && p[1] == ':') begin = p + 2;
+    append(begin, end);
+
+    const char *isa_key = "cpu_isa_t isa = mkldnn::impl::cpu::";
+    const char *isa = strstr(end, isa_key);
+    if (isa != nullptr) {
+        isa += strlen(isa_key);
+        const char *isa_end = isa;
+        while (*isa_end != '\0' && *isa_end != ';' && *isa_end != ']')
+            ++isa_end;
+        if (len < buf_len - 1) buf[len++] = ':';
+        append(isa, isa_end);
+    }
+    buf[len] = '\0';
+}
+
+int md2str(char *buf, size_t buf_len, const char *prefix, int idx,
+        const memory_pd_t *mpd) {
+    if (mpd == nullptr) return 0;
+    const memory_desc_t *md = mpd->desc();
+    int written = snprintf(buf, buf_len, " %s%d:%s:%s:", prefix, idx,
+            dt2str(md->data_type), fmt2str(md->format));
+    for (int d = 0; d < md->ndims; ++d) {
+        if (written < 0 || (size_t)written >= buf_len) break;
+        written += snprintf(buf + written, buf_len - written, "%s%d",
+                d == 0 ? "" : "x", md->dims[d]);
+    }
+    return written;
+}
+}
+
+void verbose_print(const char *stage, const primitive_desc_t *pd,
+        double duration_ms) {
+    const size_t buf_len = 1024;
+    char name[256], mem[buf_len] = "";
+
+    impl_name(name, sizeof(name), pd->name());
+
+    size_t written = 0;
+    auto append = [&](const char *prefix, int idx, const memory_pd_t *mpd) {
+        if (written >= buf_len) return;
+        int w = md2str(mem + written, buf_len - written, prefix, idx, mpd);
+        if (w > 0) written += w;
+    };
+    for (int i = 0; i < pd->n_inputs(); ++i) append("in", i, pd->input_pd(i));
+    for (int i = 0; i < pd->n_outputs(); ++i)
+        append("out", i, pd->output_pd(i));
+
+    printf("mkldnn_verbose,%s,%s,%s,%s,%g\n", stage, prim_kind2str(pd->kind()),
+            name, mem[0] == ' ' ? mem + 1 : mem, duration_ms);
+    fflush(0);
+}
+
+}
+}
+
+mkldnn_status_t mkldnn_verbose_set(int level) {
+    using namespace mkldnn::impl::status;
+    if (level < mkldnn::impl::verbose_none
+            || level > mkldnn::impl::verbose_create)
+        return invalid_arguments;
+    mkldnn::impl::verbose().level = level;
+    return success;
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
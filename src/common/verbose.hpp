@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef VERBOSE_HPP
+#define VERBOSE_HPP
+
+#include <atomic>
+
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+/** verbosity levels, the initial level is taken from the MKLDNN_VERBOSE
+ * environment variable and can be changed with mkldnn_verbose_set() */
+enum verbose_level_t {
+    /** no output */
+    verbose_none = 0,
+    /** one line per executed primitive */
+    verbose_exec = 1,
+    /** additionally, one line per created primitive (the creation time
+     * includes the jit code generation) */
+    verbose_create = 2,
+};
+
+struct verbose_t {
+    verbose_t(int level): level(level) {}
+    /* changed by mkldnn_verbose_set() concurrently with the readers */
+    std::atomic<int> level;
+};
+
+const verbose_t *mkldnn_verbose();
+
+/** returns wall time in milliseconds */
+double get_msec();
+
+/** prints a verbose line `mkldnn_verbose,<stage>,<primitive info>,<time>` for
+ * a primitive described by @p pd */
+void verbose_print(const char *stage, const primitive_desc_t *pd,
+        double duration_ms);
+
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -22,6 +22,7 @@
 #include "c_types_map.hpp"
 #include "batch_normalization_pd.hpp"
 #include "cpu_engine.hpp"
+#include "cpu_cost_model.hpp"
 #include "cpu_memory.hpp"
 #include "cpu_primitive.hpp"
 #include "type_helpers.hpp"
@@ -66,6 +67,11 @@ struct cpu_batch_normalization_fwd_pd_t: public batch_normalization_fwd_pd_t {
     virtual const cpu_memory_pd_t *weights_pd(int index = 0) const override
     { return index == 0 ? &scaleshift_pd_ : nullptr; }
 
+    virtual double time_estimate() const override {
+        return estimate_time(sizeof(float), ref_efficiency, bnorm_flops(this),
+                bnorm_bytes(this));
+    }
+
 protected:
     cpu_memory_pd_t data_pd_;
     cpu_memory_pd_t mean_pd_;
@@ -108,6 +114,11 @@ struct cpu_batch_normalization_bwd_pd_t: public batch_normalization_bwd_pd_t {
     virtual const cpu_memory_pd_t *diff_src_pd(int index = 0) const override
     { return index == 0 ? &diff_data_pd_ : nullptr; }
 
+    virtual double time_estimate() const override {
+        return estimate_time(sizeof(float), ref_efficiency, bnorm_flops(this),
+                bnorm_bytes(this));
+    }
+
 protected:
     cpu_memory_pd_t data_pd_;
     cpu_memory_pd_t mean_pd_;
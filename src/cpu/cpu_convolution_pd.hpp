@@ -22,6 +22,7 @@
 #include "c_types_map.hpp"
 #include "convolution_pd.hpp"
 #include "cpu_engine.hpp"
+#include "cpu_cost_model.hpp"
 #include "cpu_memory.hpp"
 #include "cpu_primitive.hpp"
 #include "type_helpers.hpp"
@@ -56,6 +57,11 @@ struct _cpu_convolution_fwd_pd_t: public _convolution_fwd_pd_t<with_relu> {
         return nullptr;
     }
 
+    virtual double time_estimate() const override {
+        return estimate_time(sizeof(float), ref_efficiency, conv_flops(this),
+                io_bytes(this));
+    }
+
 protected:
     cpu_memory_pd_t src_pd_, dst_pd_;
     cpu_memory_pd_t weights_pd_, bias_pd_;
@@ -97,6 +103,11 @@ struct cpu_convolution_bwd_data_pd_t: public convolution_bwd_data_pd_t {
     virtual const cpu_memory_pd_t *weights_pd(int index = 0) const override
     { return index == 0 ? &weights_pd_ : nullptr; }
 
+    virtual double time_estimate() const override {
+        return estimate_time(sizeof(float), ref_efficiency, conv_flops(this),
+                io_bytes(this));
+    }
+
 protected:
     cpu_memory_pd_t diff_src_pd_, diff_dst_pd_;
     cpu_memory_pd_t weights_pd_;
@@ -138,6 +149,11 @@ struct cpu_convolution_bwd_weights_pd_t: public convolution_bwd_weights_pd_t {
             return  nullptr;
         }
 
+    virtual double time_estimate() const override {
+        return estimate_time(sizeof(float), ref_efficiency, conv_flops(this),
+                io_bytes(this));
+    }
+
 protected:
     cpu_memory_pd_t src_pd_;
     cpu_memory_pd_t diff_dst_pd_;
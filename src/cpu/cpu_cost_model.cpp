@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "memory_pd.hpp"
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+
+#include "cpu_cost_model.hpp"
+#include "jit_generator.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+namespace {
+const double frequency = 2e9; /* cycles per second */
+const double bandwidth_per_thread = 1e10; /* bytes per second */
+const double bandwidth_max = 1e11; /* bytes per second */
+}
+
+double estimate_time(int vlen, double efficiency, double flops,
+        double bytes) {
+    const int nthr = mkldnn_get_max_threads();
+    const int simd_w = nstl::max(1, vlen / (int)sizeof(float));
+
+    /* the vector code issues two fma per cycle, the scalar one (and sse)
+     * a multiplication and an addition */
+    const double flops_per_cycle = simd_w >= 8 ? 4. * simd_w : 2. * simd_w;
+    const double compute = flops
+        / (efficiency * flops_per_cycle * frequency * nthr);
+    const double memory = bytes
+        / nstl::min(bandwidth_per_thread * nthr, bandwidth_max);
+
+    return nstl::max(compute, memory);
+}
+
+int gemm_vlen() {
+    if (mayiuse(avx512_common)) return cpu_isa_traits<avx512_common>::vlen;
+    if (mayiuse(avx2)) return cpu_isa_traits<avx2>::vlen;
+    if (mayiuse(sse42)) return cpu_isa_traits<sse42>::vlen;
+    return sizeof(float);
+}
+
+double io_bytes(const primitive_desc_t *pd) {
+    double bytes = 0;
+    for (int i = 0; i < pd->n_inputs(); ++i)
+        bytes += pd->input_pd(i)->get_size();
+    for (int o = 0; o < pd->n_outputs(); ++o)
+        bytes += pd->output_pd(o)->get_size();
+    return bytes;
+}
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
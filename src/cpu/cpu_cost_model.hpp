@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_COST_MODEL_HPP
+#define CPU_COST_MODEL_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/** the efficiency (fraction of the peak of the scalar code) of the reference
+ * implementations */
+const double ref_efficiency = 0.25;
+
+/** a roofline estimate of the execution time (seconds) of @p flops floating
+ * point operations and @p bytes of memory traffic spread over all the
+ * threads. The implementation uses the vector registers of @p vlen bytes
+ * (sizeof(float) for the scalar code) and reaches @p efficiency of their
+ * peak.
+ *
+ * @note the machine parameters are nominal: the estimates are meant to rank
+ *       the implementations and the algorithms, not to predict the timings */
+double estimate_time(int vlen, double efficiency, double flops, double bytes);
+
+/** the width (bytes) of the vector registers used by the external (MKL or
+ * cblas) gemm, which picks the widest ISA available */
+int gemm_vlen();
+
+/** the size (bytes) of the inputs and the outputs of @p pd */
+double io_bytes(const primitive_desc_t *pd);
+
+/** the number of floating point operations of the direct convolution */
+template <typename pd_t> double conv_flops(const pd_t *pd) {
+    return 2. * pd->MB() * pd->OC() * pd->IC() / pd->G()
+        * pd->OH() * pd->OW() * pd->KH() * pd->KW();
+}
+
+/** the number of floating point operations of the inner product */
+template <typename pd_t> double ip_flops(const pd_t *pd)
+{ return 2. * pd->MB() * pd->OC() * pd->IC_total(); }
+
+/** the number of operations of the pooling */
+template <typename pd_t> double pool_flops(const pd_t *pd) {
+    return (double)pd->MB() * pd->C() * pd->OH() * pd->OW()
+        * pd->KH() * pd->KW();
+}
+
+/** the number of floating point operations of the batch normalization: the
+ * statistics (if computed) take 3 per point, the normalization 2 (and twice
+ * as much backward) */
+template <typename pd_t> double bnorm_flops(const pd_t *pd) {
+    const double nelems = (double)pd->MB() * pd->C() * pd->H() * pd->W();
+    if (!pd->is_fwd()) return 10. * nelems;
+    return (pd->stats_is_src() ? 2. : 5.) * nelems;
+}
+
+/** the memory traffic of the batch normalization: computing the statistics
+ * reads the source twice more */
+template <typename pd_t> double bnorm_bytes(const pd_t *pd) {
+    const double src_bytes = pd->src_pd()->get_size();
+    const bool compute_stats = !pd->is_fwd() || !pd->stats_is_src();
+    return io_bytes(pd) + (compute_stats ? 2. * src_bytes : 0.);
+}
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -15,10 +15,16 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <atomic>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "cpu_engine.hpp"
 #include "cpu_memory.hpp"
 #include "type_helpers.hpp"
+#include "verbose.hpp"
 
 #include "cpu_concat.hpp"
 #include "cpu_sum.hpp"
@@ -226,11 +232,90 @@ const pd_create_f* cpu_engine_t::get_implementation_list() const {
     return cpu_impl_list;
 }
 
+int get_cpu_isa_tag() {
+    const cpu_isa_t isa_list[] = { avx512_mic_4ops, avx512_mic, avx512_core,
+        avx512_common, avx2, sse42 };
+    for (size_t i = 0; i < sizeof(isa_list) / sizeof(isa_list[0]); ++i)
+        if (mayiuse(isa_list[i])) return isa_list[i];
+    return isa_any;
+}
+
+namespace {
+unsigned isa_bit(cpu_isa_t isa) { return 1u << isa; }
+
+/* avx512_core and avx512_mic are different extensions of avx512_common, so
+ * the ISAs allowed by a limit are not a prefix of cpu_isa_t */
+unsigned allowed_isa_mask(cpu_isa_t max_isa) {
+    switch (max_isa) {
+    case sse42: return isa_bit(isa_any) | isa_bit(sse42);
+    case avx2: return allowed_isa_mask(sse42) | isa_bit(avx2);
+    case avx512_common:
+        return allowed_isa_mask(avx2) | isa_bit(avx512_common);
+    case avx512_core:
+        return allowed_isa_mask(avx512_common) | isa_bit(avx512_core);
+    case avx512_mic:
+        return allowed_isa_mask(avx512_common) | isa_bit(avx512_mic);
+    case avx512_mic_4ops:
+        return allowed_isa_mask(avx512_mic) | isa_bit(avx512_mic_4ops);
+    default: return ~0u;
+    }
+}
+
+/* an unknown value is reported and ignored, i.e. no limit is set */
+unsigned allowed_isa_mask_from_env() {
+    const char *val = getenv("MKLDNN_MAX_CPU_ISA");
+    if (val == nullptr) return allowed_isa_mask(isa_any);
+
+    char name[32] = "";
+    for (size_t i = 0; val[i] != '\0' && i < sizeof(name) - 1; ++i)
+        name[i] = (char)toupper(val[i]);
+
+    const struct { const char *name; cpu_isa_t isa; } isa_names[] = {
+        { "SSE42", sse42 },
+        { "AVX2", avx2 },
+        { "AVX512_COMMON", avx512_common },
+        { "AVX512_CORE", avx512_core },
+        { "AVX512_MIC", avx512_mic },
+        { "AVX512_MIC_4OPS", avx512_mic_4ops },
+        { "ALL", isa_any },
+    };
+    for (size_t i = 0; i < sizeof(isa_names) / sizeof(isa_names[0]); ++i)
+        if (strcmp(name, isa_names[i].name) == 0)
+            return allowed_isa_mask(isa_names[i].isa);
+
+    fprintf(stderr, "mkldnn: unknown MKLDNN_MAX_CPU_ISA value '%s' is "
+            "ignored\n", val);
+    return allowed_isa_mask(isa_any);
+}
+
+/* the initialization of a function-local static is thread-safe */
+std::atomic<unsigned> &allowed_isas() {
+    static std::atomic<unsigned> mask(allowed_isa_mask_from_env());
+    return mask;
+}
+}
+
+bool cpu_isa_allowed(cpu_isa_t isa) {
+    return (allowed_isas() & isa_bit(isa)) != 0;
+}
+
+void set_max_cpu_isa(cpu_isa_t max_isa) {
+    allowed_isas() = allowed_isa_mask(max_isa);
+}
+
 cpu_engine_factory_t engine_factory;
 
 status_t cpu_engine_t::submit(primitive_t *p, event_t *e,
         event_vector &prerequisites) {
-    p->execute(e);
+    if (mkldnn_verbose()->level >= verbose_exec
+            && p->kind() != primitive_kind::memory) {
+        double ms = get_msec();
+        p->execute(e);
+        ms = get_msec() - ms;
+        verbose_print("exec", p->pd(), ms);
+    } else {
+        p->execute(e);
+    }
     return success;
 }
 
@@ -238,4 +323,20 @@ status_t cpu_engine_t::submit(primitive_t *p, event_t *e,
 }
 }
 
+mkldnn_status_t mkldnn_set_max_cpu_isa(mkldnn_cpu_isa_t isa) {
+    using namespace mkldnn::impl::cpu;
+    using namespace mkldnn::impl::status;
+    switch (isa) {
+    case mkldnn_isa_all: set_max_cpu_isa(isa_any); break;
+    case mkldnn_sse42: set_max_cpu_isa(sse42); break;
+    case mkldnn_avx2: set_max_cpu_isa(avx2); break;
+    case mkldnn_avx512_common: set_max_cpu_isa(avx512_common); break;
+    case mkldnn_avx512_core: set_max_cpu_isa(avx512_core); break;
+    case mkldnn_avx512_mic: set_max_cpu_isa(avx512_mic); break;
+    case mkldnn_avx512_mic_4ops: set_max_cpu_isa(avx512_mic_4ops); break;
+    default: return invalid_arguments;
+    }
+    return success;
+}
+
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
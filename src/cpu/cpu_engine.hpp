@@ -23,14 +23,20 @@
 
 #include "c_types_map.hpp"
 #include "../common/engine.hpp"
+#include "../common/primitive_desc_cache.hpp"
+#include "../common/primitive_desc_tuner.hpp"
 
 namespace mkldnn {
 namespace impl {
 namespace cpu {
 
+/** returns a tag of the ISA the jit implementations are allowed to use */
+int get_cpu_isa_tag();
+
 class cpu_engine_t: public engine_t {
 public:
-    cpu_engine_t(): engine_t(engine_kind::cpu) {}
+    cpu_engine_t(): engine_t(engine_kind::cpu), pd_cache_(get_cpu_isa_tag)
+        , pd_tuner_(get_cpu_isa_tag) {}
 
     virtual status_t submit(primitive_t *p, event_t *e,
             event_vector &prerequisites);
@@ -50,6 +56,13 @@ public:
     virtual const sum_primitive_desc_create_f*
         get_sum_implementation_list() const;
     virtual const primitive_desc_create_f* get_implementation_list() const;
+
+    virtual primitive_desc_cache_t *pd_cache() const { return &pd_cache_; }
+    virtual primitive_desc_tuner_t *pd_tuner() const { return &pd_tuner_; }
+
+private:
+    mutable primitive_desc_cache_t pd_cache_;
+    mutable primitive_desc_tuner_t pd_tuner_;
 };
 
 class cpu_engine_factory_t: public engine_factory_t {
@@ -22,6 +22,7 @@
 #include "c_types_map.hpp"
 #include "pooling_pd.hpp"
 #include "cpu_engine.hpp"
+#include "cpu_cost_model.hpp"
 #include "cpu_memory.hpp"
 #include "cpu_primitive.hpp"
 #include "type_helpers.hpp"
@@ -58,6 +59,11 @@ struct cpu_pooling_fwd_pd_t: public pooling_fwd_pd_t {
     virtual const cpu_memory_pd_t *workspace_pd(int index = 0) const override
     { return (index == 0 && !ws_pd_.is_zero()) ? &ws_pd_ : nullptr; }
 
+    virtual double time_estimate() const override {
+        return estimate_time(sizeof(float), ref_efficiency, pool_flops(this),
+                io_bytes(this));
+    }
+
 protected:
     cpu_memory_pd_t src_pd_;
     cpu_memory_pd_t dst_pd_;
@@ -91,6 +97,11 @@ struct cpu_pooling_bwd_pd_t: public pooling_bwd_pd_t {
     virtual const cpu_memory_pd_t *workspace_pd(int index = 0) const override
     { return (index == 0 && !ws_pd_.is_zero()) ? &ws_pd_ : nullptr; }
 
+    virtual double time_estimate() const override {
+        return estimate_time(sizeof(float), ref_efficiency, pool_flops(this),
+                io_bytes(this));
+    }
+
 protected:
     cpu_memory_pd_t diff_src_pd_;
     cpu_memory_pd_t diff_dst_pd_;
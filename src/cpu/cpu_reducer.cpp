@@ -295,6 +295,17 @@ cpu_reducer_t<data_type>::~cpu_reducer_t() {
     delete drv_;
 }
 
+template <impl::data_type_t data_type>
+size_t cpu_reducer_t<data_type>::space_size(
+        const reduce_balancer_t &balancer) {
+    if (balancer.nthr_per_group_ == 1) return 0;
+
+    const size_t ws_size = balancer.ngroups_ * (balancer.nthr_per_group_ - 1)
+        * balancer.njobs_per_group_ub_ * balancer.job_size_;
+    return ws_size * sizeof(data_t)
+        + balancer.ngroups_ * sizeof(simple_barrier::ctx_t);
+}
+
 template <impl::data_type_t data_type>
 void cpu_reducer_t<data_type>::allocate_workspace() {
     if (balancer_.nthr_per_group_ == 1) return;
@@ -393,6 +404,18 @@ cpu_reducer_2d_t<data_type>::~cpu_reducer_2d_t() {
     delete drv_;
 }
 
+template <impl::data_type_t data_type>
+size_t cpu_reducer_2d_t<data_type>::space_size(
+        const reduce_balancer_t &balancer, bool master_uses_dst) {
+    if (balancer.nthr_per_group_ == 1) return 0;
+
+    const size_t ws_size = balancer.ngroups_
+        * (balancer.nthr_per_group_ - master_uses_dst)
+        * balancer.njobs_per_group_ub_ * balancer.job_size_;
+    return ws_size * sizeof(data_t)
+        + balancer.ngroups_ * sizeof(simple_barrier::ctx_t);
+}
+
 template <impl::data_type_t data_type>
 void cpu_reducer_2d_t<data_type>::allocate_workspace() {
     if (balancer_.nthr_per_group_ == 1) return;
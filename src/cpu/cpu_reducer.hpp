@@ -65,8 +65,9 @@ namespace cpu {
 struct reduce_balancer_t {
     reduce_balancer_t(int nthr, int job_size, int njobs, int reduction_size,
             size_t max_buffer_size)
-        : syncable_(true), nthr_(nthr), job_size_(job_size), njobs_(njobs)
-        , reduction_size_(reduction_size), max_buffer_size_(max_buffer_size)
+        : syncable_(MKLDNN_THR_SYNC == 1), nthr_(nthr), job_size_(job_size)
+        , njobs_(njobs), reduction_size_(reduction_size)
+        , max_buffer_size_(max_buffer_size)
     { balance(); }
 
     bool syncable_;
@@ -156,6 +157,9 @@ struct cpu_reducer_t {
     cpu_reducer_t(const reduce_balancer_t &balancer);
     ~cpu_reducer_t();
 
+    /** returns the memory a reducer with @p balancer allocates (bytes) */
+    static size_t space_size(const reduce_balancer_t &balancer);
+
     /** allocates internal buffer for partial computations. */
     void allocate_workspace();
 
@@ -206,6 +210,10 @@ struct cpu_reducer_2d_t {
             bool master_uses_dst);
     ~cpu_reducer_2d_t();
 
+    /** returns the memory a reducer with @p balancer allocates (bytes) */
+    static size_t space_size(const reduce_balancer_t &balancer,
+            bool master_uses_dst);
+
     /** allocates internal buffer for partial computations. */
     void allocate_workspace();
 
@@ -54,15 +54,8 @@ void _gemm_convolution_fwd_t<with_relu, run_jit, isa>::execute_forward() {
 
     const size_t work_amount = jcp.ngroups * jcp.mb;
     //Check: Can we use GEMM parallelism or do parallelization by minibatch?
-    int num_thr = ((jcp.oh * jcp.ow) / omp_get_max_threads() < 256 && jcp.mb != 1)
-        ? omp_get_max_threads()
-        : 1;
-    MAYBE_UNUSED(num_thr);
-#pragma omp parallel num_threads(num_thr)
-    {
-        const int ithr = omp_get_thread_num();
-        const int nthr = omp_get_num_threads();
-
+    const int num_thr = conf_.mb_nthr();
+    parallel(num_thr, [&](const int ithr, const int nthr) {
         int g{0}, n{0};
         size_t start = 0, end = 0;
 
@@ -121,7 +114,7 @@ void _gemm_convolution_fwd_t<with_relu, run_jit, isa>::execute_forward() {
             }
             nd_iterator_step(g, jcp.ngroups, n, jcp.mb);
         }
-    }
+    });
 }
 
 template <bool run_jit, cpu_isa_t isa>
@@ -142,20 +135,13 @@ void _gemm_convolution_bwd_data_t<run_jit, isa>::execute_backward_data() {
     const data_t zero = 0.0, one = 1.0;
 
     const size_t work_amount = jcp.ngroups * jcp.mb;
-    int num_thr = (jcp.mb != 1) ? omp_get_max_threads() : 1;
-    MAYBE_UNUSED(num_thr);
-#pragma omp parallel num_threads(num_thr)
-    {
-        const int ithr = omp_get_thread_num();
-        const int nthr = omp_get_num_threads();
-
+    const int num_thr = conf_.mb_nthr();
+    parallel(num_thr, [&](const int ithr, const int nthr) {
         int g{0}, n{0};
         size_t start = 0, end = 0;
         balance211(work_amount, nthr, ithr, start, end);
         nd_iterator_init(start, g, jcp.ngroups, n, jcp.mb);
         for (size_t iwork = start; iwork < end; ++iwork) {
-            const int ithr = omp_get_thread_num();
-
             data_t *_diff_src = diff_src + (n * jcp.ngroups + g)*src_step;
             const data_t *_diff_dst = diff_dst + (n * jcp.ngroups + g)*dst_step;
             const data_t *_weights = weights + g * weights_g_size;
@@ -174,7 +160,7 @@ void _gemm_convolution_bwd_data_t<run_jit, isa>::execute_backward_data() {
                 jit_gemm_convolution_utils::col2im(jcp, _col, _diff_src);
             nd_iterator_step(g, jcp.ngroups, n, jcp.mb);
         }
-    }
+    });
 }
 
 template <bool run_jit, cpu_isa_t isa>
@@ -194,13 +180,8 @@ void _gemm_convolution_bwd_weights_t<run_jit, isa>::execute_backward_weights() {
     const int M = jcp.ic * jcp.ks;
     const data_t zero = 0.0, one = 1.0;
 
-    int num_thr = (jcp.mb != 1) ? omp_get_max_threads() : 1;
-    MAYBE_UNUSED(num_thr);
-#pragma omp parallel num_threads(num_thr)
-    {
-        const int ithr = omp_get_thread_num();
-        const int nthr = omp_get_num_threads();
-
+    const int num_thr = conf_.mb_nthr();
+    parallel(num_thr, [&](const int ithr, const int nthr) {
         int ithr_g, nthr_g, ithr_mb, nthr_mb;
         size_t g_start{0}, g_end{0}, mb_start{0}, mb_end{0};
 
@@ -243,24 +224,21 @@ void _gemm_convolution_bwd_weights_t<run_jit, isa>::execute_backward_weights() {
                 }
             }
             if (need_reduction) {
-                #pragma omp barrier
+                mkldnn_thr_barrier();
                 data_t *weights_base = diff_weights + g_start * weights_g_size;
                 jit_gemm_convolution_utils::bwd_weights_reduction_par(
                     ithr_mb, nthr_mb, jcp, weights_reduce_base, weights_base);
             }
         } else
             if (need_reduction) {
-                #pragma omp barrier
+                mkldnn_thr_barrier();
             }
-    }
+    });
     if (jcp.with_bias) {
         const memory_desc_wrapper diff_dst_d(this->conf_.diff_dst_pd());
         const memory_desc_wrapper diff_bias_d(this->conf_.diff_weights_pd(1));
         const size_t work_amount = jcp.ngroups * jcp.oc;
-    #pragma omp parallel
-        {
-            const int ithr = omp_get_thread_num();
-            const int nthr = omp_get_num_threads();
+        parallel(0, [&](const int ithr, const int nthr) {
             int g{0}, oc{0};
             size_t start = 0, end = 0;
             balance211(work_amount, nthr, ithr, start, end);
@@ -275,7 +253,7 @@ void _gemm_convolution_bwd_weights_t<run_jit, isa>::execute_backward_weights() {
                 diff_bias[diff_bias_d.off(g*jcp.oc+oc)] = db;
                 nd_iterator_step(g, jcp.ngroups, oc, jcp.oc);
             }
-        }
+        });
     }
 }
 
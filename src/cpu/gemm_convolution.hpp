@@ -41,6 +41,24 @@ static inline bool constexpr _gemm_convolution_implemented() {
     return run_jit ? mayiuse(isa) : false;
 #endif
 }
+
+/* the vector width (bytes) of the gemm used */
+template<bool run_jit, cpu_isa_t isa>
+static inline int _gemm_convolution_vlen() {
+    if (!run_jit) return gemm_vlen();
+    return isa == avx512_common
+        ? cpu_isa_traits<avx512_common>::vlen : cpu_isa_traits<avx2>::vlen;
+}
+
+/* im2col writes and gemm reads the columns of the source, unless the
+ * convolution is a plain 1x1 one */
+template <typename pd_t> double im2col_bytes(const pd_t *pd) {
+    const bool is_1x1 = true
+        && utils::everyone_is(1, pd->KH(), pd->KW(), pd->KSH(), pd->KSW())
+        && utils::everyone_is(0, pd->padT(), pd->padL());
+    return is_1x1 ? 0. : 2. * sizeof(float) * pd->MB() * pd->IC()
+        * pd->KH() * pd->KW() * pd->OH() * pd->OW();
+}
 }
 
 template <bool with_relu, bool run_jit, cpu_isa_t isa>
@@ -56,6 +74,12 @@ struct _gemm_convolution_fwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_gemm_convolution_fwd_t<with_relu, run_jit, isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(_gemm_convolution_vlen<run_jit, isa>(),
+                    run_jit ? 0.6 : 0.7, conv_flops(this),
+                    io_bytes(this) + im2col_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace memory_format;
@@ -78,7 +102,28 @@ struct _gemm_convolution_fwd_t: public cpu_primitive_t {
                     && this->weights_pd_.desc()->format
                             == (this->with_groups() ? goihw : oihw)
                     && this->is_gemm_conv_format();
-            return ok ? status::success : status::unimplemented;
+            if (!ok) return status::unimplemented;
+
+            jit_gemm_convolution_utils::init_conf(jcp_, this->cdesc_(),
+                    this->src_pd(), this->weights_pd(0), this->dst_pd(),
+                    with_relu, this->negative_slope());
+            return status::success;
+        }
+
+        virtual size_t memory_consumption() const override {
+            const int sgemm_nthr
+                = mb_nthr() == 1 ? mkldnn_get_max_threads() : 1;
+            return jit_gemm_convolution_utils::workspace_size(jcp_, false, 0)
+                + (!run_jit ? 0 : jit_uni_gemm_f32::memory_consumption()
+                        + jit_uni_gemm_f32::sgemm_memory_consumption(jcp_.os,
+                            jcp_.oc, jcp_.ic * jcp_.ks, sgemm_nthr));
+        }
+
+        /* the minibatch is split across the threads unless it is small and
+         * the spatial size is large enough for sgemm to be parallel */
+        int mb_nthr() const {
+            const int max_thr = mkldnn_get_max_threads();
+            return (jcp_.os / max_thr < 256 && jcp_.mb != 1) ? max_thr : 1;
         }
 
         jit_gemm_conv_conf_t jcp_;
@@ -128,9 +173,6 @@ struct _gemm_convolution_fwd_t: public cpu_primitive_t {
         if (run_jit)
             sgemm_ = new jit_uni_gemm_f32('N', 'N', 0.0, false);
 
-        jit_gemm_convolution_utils::init_conf(conf_.jcp_,
-            *(conf_.cdesc()), conf_.src_pd(), conf_.weights_pd(0),
-            conf_.dst_pd(), with_relu, conf_.negative_slope());
         jit_gemm_convolution_utils::prepare_workspace(this->conf_.jcp_,
             &this->ws, false, 0L);
     }
@@ -181,6 +223,12 @@ struct _gemm_convolution_bwd_data_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_gemm_convolution_bwd_data_t<run_jit, isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(_gemm_convolution_vlen<run_jit, isa>(),
+                    run_jit ? 0.6 : 0.7, conv_flops(this),
+                    io_bytes(this) + im2col_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace memory_format;
@@ -201,9 +249,27 @@ struct _gemm_convolution_bwd_data_t: public cpu_primitive_t {
                 && this->diff_dst_pd_.desc()->format == nchw
                 && this->weights_pd_.desc()->format == (this->with_groups()
                         ? goihw : oihw);
-            return ok ? status::success : status::unimplemented;
+            if (!ok) return status::unimplemented;
+
+            jit_gemm_convolution_utils::init_conf(jcp_, *this->desc(),
+                    this->diff_src_pd(), this->weights_pd(0),
+                    this->diff_dst_pd());
+            return status::success;
         }
 
+        virtual size_t memory_consumption() const override {
+            const int sgemm_nthr
+                = mb_nthr() == 1 ? mkldnn_get_max_threads() : 1;
+            return jit_gemm_convolution_utils::workspace_size(jcp_, true, 0)
+                + (!run_jit ? 0 : jit_uni_gemm_f32::memory_consumption()
+                        + jit_uni_gemm_f32::sgemm_memory_consumption(jcp_.os,
+                            jcp_.ic * jcp_.ks, jcp_.oc, sgemm_nthr));
+        }
+
+        /* the minibatch is split across the threads unless it is 1 */
+        int mb_nthr() const
+        { return jcp_.mb != 1 ? mkldnn_get_max_threads() : 1; }
+
         jit_gemm_conv_conf_t jcp_;
 
     protected:
@@ -229,9 +295,6 @@ struct _gemm_convolution_bwd_data_t: public cpu_primitive_t {
         if (run_jit)
             sgemm_ = new jit_uni_gemm_f32('N', 'T', 0.0, false);
 
-        jit_gemm_convolution_utils::init_conf(conf_.jcp_,
-            *(conf_.desc()), conf_.diff_src_pd(), conf_.weights_pd(0),
-            conf_.diff_dst_pd());
         jit_gemm_convolution_utils::prepare_workspace(this->conf_.jcp_,
             &this->ws, true, 0L);
     }
@@ -283,6 +346,12 @@ struct _gemm_convolution_bwd_weights_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_gemm_convolution_bwd_weights_t<run_jit, isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(_gemm_convolution_vlen<run_jit, isa>(),
+                    run_jit ? 0.55 : 0.65, conv_flops(this),
+                    io_bytes(this) + im2col_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace memory_format;
@@ -305,9 +374,31 @@ struct _gemm_convolution_bwd_weights_t: public cpu_primitive_t {
             && this->diff_dst_pd_.desc()->format == nchw
             && this->diff_weights_pd_.desc()->format == (this->with_groups()
                     ? goihw : oihw);
-            return ok ? status::success : status::unimplemented;
+            if (!ok) return status::unimplemented;
+
+            jit_gemm_convolution_utils::init_conf(jcp_, *this->desc(),
+                    this->src_pd(), this->diff_weights_pd(0),
+                    this->diff_dst_pd());
+            return status::success;
         }
 
+        virtual size_t memory_consumption() const override {
+            /* the calls of sgemm_0 and sgemm_1 never overlap */
+            const int sgemm_nthr
+                = mb_nthr() == 1 ? mkldnn_get_max_threads() : 1;
+            const size_t sgemm_size = !run_jit ? 0
+                : 2 * jit_uni_gemm_f32::memory_consumption()
+                + jit_uni_gemm_f32::sgemm_memory_consumption(
+                        jcp_.ic * jcp_.ks, jcp_.oc, jcp_.os, sgemm_nthr);
+            return jit_gemm_convolution_utils::workspace_size(jcp_, true,
+                    memory_desc_wrapper(this->diff_weights_pd(0)).size())
+                + sgemm_size;
+        }
+
+        /* the minibatch is split across the threads unless it is 1 */
+        int mb_nthr() const
+        { return jcp_.mb != 1 ? mkldnn_get_max_threads() : 1; }
+
         jit_gemm_conv_conf_t jcp_;
 
     protected:
@@ -336,9 +427,6 @@ struct _gemm_convolution_bwd_weights_t: public cpu_primitive_t {
             sgemm_1 = new jit_uni_gemm_f32('T', 'N', 1.0, false);
         }
 
-        jit_gemm_convolution_utils::init_conf(conf_.jcp_,
-            *(conf_.desc()), conf_.src_pd(), conf_.diff_weights_pd(0),
-            conf_.diff_dst_pd());
         const memory_desc_wrapper weights_d(conf_.diff_weights_pd(0));
         jit_gemm_convolution_utils::prepare_workspace(this->conf_.jcp_,
             &this->ws, true, weights_d.size());
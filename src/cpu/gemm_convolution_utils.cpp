@@ -38,11 +38,7 @@ void im2col(
 
     auto im2col_1st = [&](const float *im, float *col) {
         const size_t work_amount = jcp.oh * jcp.kh;
-        #pragma omp parallel
-        {
-            const int ithr = omp_get_thread_num();
-            const int nthr = omp_get_num_threads();
-
+        parallel(0, [&](const int ithr, const int nthr) {
             size_t start = 0, end = 0;
             int oh = 0, kh = 0;
             balance211(work_amount, nthr, ithr, start, end);
@@ -67,16 +63,12 @@ void im2col(
                 }}
                 nd_iterator_step(kh, jcp.kh, oh, jcp.oh);
             }
-        }
+        });
     };
 
     auto im2col_common = [&](const float *im, float *col) {
         const size_t work_amount = jcp.ic;
-        #pragma omp parallel
-        {
-            const int ithr = omp_get_thread_num();
-            const int nthr = omp_get_num_threads();
-
+        parallel(0, [&](const int ithr, const int nthr) {
             size_t start = 0, end = 0, ic = 0;
             balance211(work_amount, nthr, ithr, start, end);
             nd_iterator_init(start, ic, jcp.ic);
@@ -109,7 +101,7 @@ void im2col(
 
                 nd_iterator_step(ic, jcp.ic);
             }
-        }
+        });
     };
 
     if (jcp.ic != 1) {
@@ -125,11 +117,11 @@ void col2im(
     const size_t im_step = jcp.ih * jcp.iw;
     const int iS = jcp.ih * jcp.iw;
 
-    int num_thr = (jcp.mb != 1) ? omp_get_max_threads() : 1;
-    MAYBE_UNUSED(num_thr);
-#pragma omp parallel for  num_threads(num_thr)
-    for (int ic = 0; ic < jcp.ic; ++ic) {
-        for (int is = 0; is < iS; ++is) im[is] = 0.;
+    auto col2im_ic = [&](const int ic) {
+        const float *_col = col + ic * col_step;
+        float *_im = im + ic * im_step;
+
+        for (int is = 0; is < iS; ++is) _im[is] = 0.;
 
         for (int oh = 0; oh < jcp.oh; ++oh) {
         for (int kh = 0; kh < jcp.kh; ++kh) {
@@ -143,13 +135,18 @@ void col2im(
 
                 const size_t col_idx = ((kh*jcp.kw + kw)*jcp.oh+oh)*jcp.ow+ow;
                 const size_t im_idx = ih*jcp.iw + iw;
-                im[im_idx] += col[col_idx];
+                _im[im_idx] += _col[col_idx];
             }
             }
         }
         }
-        col += col_step;
-        im += im_step;
+    };
+
+    /* the caller parallelizes over the minibatch unless it is 1 */
+    if (mkldnn_in_parallel()) {
+        for (int ic = 0; ic < jcp.ic; ++ic) col2im_ic(ic);
+    } else {
+        parallel_nd(jcp.ic, col2im_ic);
     }
 }
 
@@ -195,31 +192,37 @@ void init_conf(
     jcp.os = jcp.oh * jcp.ow;
     jcp.ks = jcp.kh * jcp.kw;
     jcp.need_im2col = !(jcp.oh == jcp.ih && jcp.ow == jcp.iw && jcp.ks == 1);
-}
 
-status_t prepare_workspace(
-        jit_gemm_conv_conf_t &jcp, float **ws, bool is_bwd_weights,
-        const size_t weights_size) {
-    const size_t nthr = omp_get_max_threads();
+    const size_t nthr = mkldnn_get_max_threads();
     if (jcp.need_im2col) {
         const size_t sz_per_thread = jcp.ic*jcp.ks*jcp.os;
         jcp.im2col_size = utils::rnd_up(nthr*sz_per_thread, 16);
     } else {
         jcp.im2col_size = 0;
     }
+}
+
+size_t workspace_size(const jit_gemm_conv_conf_t &jcp, bool is_bwd_weights,
+        const size_t weights_size) {
+    const size_t nthr = mkldnn_get_max_threads();
     size_t weights_reduce_size = 0;
     if (is_bwd_weights && jcp.mb != 1 && nthr != 1) {
         const size_t sz_per_thread = jcp.ngroups * weights_size;
         weights_reduce_size = nthr * sz_per_thread;
     }
+    return sizeof(float)*jcp.im2col_size + weights_reduce_size;
+}
+
+status_t prepare_workspace(
+        const jit_gemm_conv_conf_t &jcp, float **ws, bool is_bwd_weights,
+        const size_t weights_size) {
     *ws = 0;
-    const size_t ws_size = sizeof(float)*jcp.im2col_size + weights_reduce_size;
+    const size_t ws_size = workspace_size(jcp, is_bwd_weights, weights_size);
     if (ws_size != 0) {
         *ws = (float*)malloc(ws_size, 64);
         if (*ws == NULL) return status::out_of_memory;
 
-#       pragma omp parallel for
-        for (size_t i = 0; i < jcp.im2col_size; ++i) (*ws)[i] = 0.;
+        parallel_nd(jcp.im2col_size, [&](size_t i) { (*ws)[i] = 0.; });
     }
     return status::success;
 }
@@ -227,7 +230,8 @@ status_t prepare_workspace(
 void bwd_weights_balance(int ithr, int nthr, int ngroups, int mb, int &ithr_g,
         int &nthr_g, int &ithr_mb, int &nthr_mb) {
     nthr_g = nstl::min(ngroups, nthr);
-    nthr_mb = nstl::min(mb, nthr / nthr_g);
+    /* reduction over minibatch requires a barrier between the threads */
+    nthr_mb = MKLDNN_THR_SYNC ? nstl::min(mb, nthr / nthr_g) : 1;
     if (ithr / nthr_mb >= ngroups) {
         ithr_g = ithr_mb = -1;
     } else {
@@ -37,7 +37,10 @@ namespace jit_gemm_convolution_utils {
         const memory_desc_wrapper &weights_d, const memory_desc_wrapper &dst_d,
         bool with_relu = false, float relu_negative_slope = -1.0);
 
-    status_t prepare_workspace(jit_gemm_conv_conf_t &jcp, float **ws,
+    /** returns the size of the im2col and the reduction buffers (bytes) */
+    size_t workspace_size(const jit_gemm_conv_conf_t &jcp,
+        bool is_bwd_filt, const size_t weights_size);
+    status_t prepare_workspace(const jit_gemm_conv_conf_t &jcp, float **ws,
         bool is_bwd_filt, const size_t weights_size);
 
     void bwd_weights_balance(int ithr, int nthr,
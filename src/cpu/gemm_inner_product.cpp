@@ -99,9 +99,9 @@ void gemm_inner_product_fwd_t<data_type>::execute_forward() {
     cblas_gemm<data_type>(CblasColMajor, CblasTrans, CblasNoTrans, OC, MB, IC,
             1.0, weights, IC, src, IC, 0.0, dst, OC);
     if (bias)
-#       pragma omp parallel for schedule(static)
-        for (cblas_int mb = 0; mb < MB; mb++)
+        parallel_nd((int)MB, [&](int mb) {
             cblas_axpy<data_type>(OC, 1.0, bias, 1, dst + dst_d.blk_off(mb), 1);
+        });
 #endif
 }
 
@@ -148,10 +148,7 @@ void gemm_inner_product_bwd_weights_t<data_type>::execute_backward_weights() {
         constexpr int blksize = 8;
         cblas_int OC_blocks = OC / blksize;
         int rem_OC = OC % blksize;
-#       pragma omp parallel
-        {
-            const int ithr = omp_get_thread_num();
-            const int nthr = omp_get_num_threads();
+        parallel(0, [&](const int ithr, const int nthr) {
             cblas_int oc_st{0}, oc_e{0};
             balance211(OC_blocks, nthr, ithr, oc_st, oc_e);
             oc_st = oc_st * blksize;
@@ -178,7 +175,7 @@ void gemm_inner_product_bwd_weights_t<data_type>::execute_backward_weights() {
                     }
                 }
             }
-        }
+        });
     }
 #endif
 }
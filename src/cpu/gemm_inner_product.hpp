@@ -39,6 +39,11 @@ struct gemm_inner_product_fwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(gemm_inner_product_fwd_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(gemm_vlen(), 0.7, ip_flops(this),
+                    io_bytes(this));
+        }
+
         virtual status_t init() override {
 #ifdef USE_CBLAS
             using namespace prop_kind;
@@ -98,6 +103,11 @@ struct gemm_inner_product_bwd_data_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(gemm_inner_product_bwd_data_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(gemm_vlen(), 0.7, ip_flops(this),
+                    io_bytes(this));
+        }
+
         virtual status_t init() override {
 #ifdef USE_CBLAS
             using namespace prop_kind;
@@ -154,6 +164,11 @@ struct gemm_inner_product_bwd_weights_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(gemm_inner_product_bwd_weights_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(gemm_vlen(), 0.7, ip_flops(this),
+                    io_bytes(this));
+        }
+
         virtual status_t init() override {
 #ifdef USE_CBLAS
             using namespace prop_kind;
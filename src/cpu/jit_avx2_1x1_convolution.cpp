@@ -147,10 +147,7 @@ void _jit_avx2_1x1_convolution_fwd_t<with_relu>::execute_forward() {
         }
     };
 
-#   pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 template struct _jit_avx2_1x1_convolution_fwd_t<true>;
@@ -259,10 +256,7 @@ void jit_avx2_1x1_convolution_bwd_data_t::execute_backward_data() {
         }
     };
 
-#   pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 /* convolution backward wtr weights */
@@ -273,38 +267,29 @@ jit_avx2_1x1_convolution_bwd_weights_t::jit_avx2_1x1_convolution_bwd_weights_t(
     : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd), kernel_(nullptr)
     , rtus_driver_(nullptr), ws_per_thread_(0), scratch_(nullptr)
 {
-    kernel_ = new jit_avx2_1x1_conv_kernel_f32(conf_.jcp_, *conf_.attr());
+    kernel_ = get_shared_kernel<jit_avx2_1x1_conv_kernel_f32>(conf_.jcp_,
+            *conf_.attr());
 
     const auto &jcp = kernel_->jcp;
 
     const int ic_block = jcp.bcast_block;
     const int nb_ic = jcp.nb_bcast;
     const int nb_ic_blocking = jcp.nb_bcast_blocking;
-    const int bcast_work = utils::div_up(nb_ic, nb_ic_blocking);
 
     const int oc_block = jcp.load_block;
     const int nb_oc = jcp.nb_load;
     const int nb_oc_blocking = jcp.nb_load_blocking;
-    const int load_work = utils::div_up(nb_oc, nb_oc_blocking);
 
     const int job_size
         = nb_oc_blocking * nb_ic_blocking * ic_block * oc_block;
-    const int njobs_x = bcast_work;
-    const int njobs_y = jcp.ngroups * load_work;
-
-    const int max_threads = omp_get_max_threads();
-    const size_t max_buffer_size = max_threads * job_size * 8;
 
     reducer_weights_ = new cpu_reducer_2d_t<data_type::f32>(
-            reduce_balancer_t(max_threads, job_size, njobs_y * njobs_x,
-                jcp.mb * jcp.nb_reduce, max_buffer_size),
+            conf_.weights_balancer(),
             job_size / nb_oc_blocking, nb_oc_blocking, ic_block,
             nb_ic * ic_block * oc_block, nb_oc, false);
 
     reducer_bias_ = !conf_.with_bias() ? nullptr
-        : new cpu_reducer_t<data_type::f32>(reduce_balancer_t(max_threads,
-                    oc_block, conf_.G() * conf_.OC() / oc_block,
-                    conf_.MB(), max_buffer_size));
+        : new cpu_reducer_t<data_type::f32>(conf_.bias_balancer());
 
     init_rtus_driver<avx2>(this);
 }
@@ -520,14 +505,11 @@ void jit_avx2_1x1_convolution_bwd_weights_t::execute_backward_weights() {
         rb->reduce(ithr, diff_bias);
     };
 
-#   pragma omp parallel
-    {
-        int ithr = omp_get_thread_num();
-        int nthr = omp_get_num_threads();
+    parallel(0, [&](const int ithr, const int nthr) {
         ker(ithr, nthr);
         if (conf_.with_bias())
             ker_bias(ithr, nthr);
-    }
+    });
 }
 
 }
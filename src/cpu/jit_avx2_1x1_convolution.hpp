@@ -22,6 +22,7 @@
 #include "cpu_engine.hpp"
 #include "cpu_reducer.hpp"
 #include "jit_avx2_1x1_conv_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 #include "jit_uni_1x1_conv_utils.hpp"
 #include "mkldnn_thread.hpp"
 #include "utils.hpp"
@@ -45,6 +46,16 @@ struct _jit_avx2_1x1_convolution_fwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_jit_avx2_1x1_convolution_fwd_t<with_relu>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx2>::vlen, 0.75,
+                    conv_flops(this), io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            return mkldnn_get_max_threads() * rtus_ws_per_thread(this)
+                * sizeof(float);
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -102,11 +113,12 @@ struct _jit_avx2_1x1_convolution_fwd_t: public cpu_primitive_t {
         , kernel_(nullptr), rtus_driver_(nullptr), ws_per_thread_(0)
         , scratch_(nullptr)
     {
-        kernel_ = new jit_avx2_1x1_conv_kernel_f32(conf_.jcp_, *conf_.attr());
+        kernel_ = get_shared_kernel<jit_avx2_1x1_conv_kernel_f32>(conf_.jcp_,
+                *conf_.attr());
         init_rtus_driver<avx2>(this);
     }
     ~_jit_avx2_1x1_convolution_fwd_t() {
-        delete kernel_;
+        release_shared_kernel(kernel_);
         delete rtus_driver_;
         free(scratch_);
     }
@@ -143,6 +155,16 @@ struct jit_avx2_1x1_convolution_bwd_data_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_avx2_1x1_convolution_bwd_data_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx2>::vlen, 0.7,
+                    conv_flops(this), io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            return mkldnn_get_max_threads() * rtus_ws_per_thread(this)
+                * sizeof(float);
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -165,6 +187,27 @@ struct jit_avx2_1x1_convolution_bwd_data_t: public cpu_primitive_t {
                     *this->diff_dst_pd_.desc(), *this->attr());
         }
 
+        reduce_balancer_t weights_balancer() const {
+            const int job_size = jcp_.nb_load_blocking
+                * jcp_.nb_bcast_blocking * jcp_.bcast_block * jcp_.load_block;
+            const int njobs_x
+                = utils::div_up(jcp_.nb_bcast, jcp_.nb_bcast_blocking);
+            const int njobs_y = jcp_.ngroups
+                * utils::div_up(jcp_.nb_load, jcp_.nb_load_blocking);
+            const int max_threads = mkldnn_get_max_threads();
+            return reduce_balancer_t(max_threads, job_size, njobs_y * njobs_x,
+                    jcp_.mb * jcp_.nb_reduce, max_threads * job_size * 8);
+        }
+
+        reduce_balancer_t bias_balancer() const {
+            const int job_size = jcp_.nb_load_blocking
+                * jcp_.nb_bcast_blocking * jcp_.bcast_block * jcp_.load_block;
+            const int max_threads = mkldnn_get_max_threads();
+            return reduce_balancer_t(max_threads, jcp_.load_block,
+                    this->G() * this->OC() / jcp_.load_block, this->MB(),
+                    max_threads * job_size * 8);
+        }
+
         // TODO (Roma): structs conf header cleanup
         jit_1x1_conv_conf_t jcp_;
         struct reduce_to_unit_stride_t {
@@ -196,11 +239,12 @@ struct jit_avx2_1x1_convolution_bwd_data_t: public cpu_primitive_t {
         , kernel_(nullptr), rtus_driver_(nullptr), ws_per_thread_(0)
         , scratch_(nullptr)
     {
-        kernel_ = new jit_avx2_1x1_conv_kernel_f32(conf_.jcp_, *conf_.attr());
+        kernel_ = get_shared_kernel<jit_avx2_1x1_conv_kernel_f32>(conf_.jcp_,
+                *conf_.attr());
         init_rtus_driver<avx2>(this);
     }
     ~jit_avx2_1x1_convolution_bwd_data_t() {
-        delete kernel_;
+        release_shared_kernel(kernel_);
         delete rtus_driver_;
         free(scratch_);
     }
@@ -240,6 +284,20 @@ struct jit_avx2_1x1_convolution_bwd_weights_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_avx2_1x1_convolution_bwd_weights_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx2>::vlen, 0.6,
+                    conv_flops(this), io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            return mkldnn_get_max_threads() * rtus_ws_per_thread(this)
+                * sizeof(float)
+                + cpu_reducer_2d_t<data_type::f32>::space_size(
+                        weights_balancer(), false)
+                + (this->with_bias() ? cpu_reducer_t<data_type::f32>
+                        ::space_size(bias_balancer()) : 0);
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -264,6 +322,27 @@ struct jit_avx2_1x1_convolution_bwd_weights_t: public cpu_primitive_t {
                     *this->diff_dst_pd_.desc(), *this->attr());
         }
 
+        reduce_balancer_t weights_balancer() const {
+            const int job_size = jcp_.nb_load_blocking
+                * jcp_.nb_bcast_blocking * jcp_.bcast_block * jcp_.load_block;
+            const int njobs_x
+                = utils::div_up(jcp_.nb_bcast, jcp_.nb_bcast_blocking);
+            const int njobs_y = jcp_.ngroups
+                * utils::div_up(jcp_.nb_load, jcp_.nb_load_blocking);
+            const int max_threads = mkldnn_get_max_threads();
+            return reduce_balancer_t(max_threads, job_size, njobs_y * njobs_x,
+                    jcp_.mb * jcp_.nb_reduce, max_threads * job_size * 8);
+        }
+
+        reduce_balancer_t bias_balancer() const {
+            const int job_size = jcp_.nb_load_blocking
+                * jcp_.nb_bcast_blocking * jcp_.bcast_block * jcp_.load_block;
+            const int max_threads = mkldnn_get_max_threads();
+            return reduce_balancer_t(max_threads, jcp_.load_block,
+                    this->G() * this->OC() / jcp_.load_block, this->MB(),
+                    max_threads * job_size * 8);
+        }
+
         // TODO (Roma): structs conf header cleanup
         jit_1x1_conv_conf_t jcp_;
 
@@ -295,7 +374,7 @@ struct jit_avx2_1x1_convolution_bwd_weights_t: public cpu_primitive_t {
     jit_avx2_1x1_convolution_bwd_weights_t(const pd_t *pd,
             const input_vector &inputs, const output_vector &outputs);
     ~jit_avx2_1x1_convolution_bwd_weights_t() {
-        delete kernel_;
+        release_shared_kernel(kernel_);
         delete rtus_driver_;
         delete reducer_weights_;
         delete reducer_bias_;
@@ -380,6 +380,8 @@ status_t jit_avx2_conv_fwd_kernel_f32::init_conf(jit_conv_conf_t &jcp,
 {
     if (!mayiuse(avx2)) return status::unimplemented;
 
+    jcp = zero<decltype(jcp)>();
+
     jcp.prop_kind = cd.prop_kind;
 
     const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
@@ -605,6 +607,8 @@ status_t jit_avx2_conv_bwd_data_kernel_f32::init_conf(jit_conv_conf_t &jcp,
 {
     if (!mayiuse(avx2)) return status::unimplemented;
 
+    jcp = zero<decltype(jcp)>();
+
     const bool with_groups = weights_d.ndims() == diff_src_d.ndims() + 1;
 
     jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
@@ -721,6 +725,8 @@ status_t jit_avx2_conv_bwd_weights_kernel_f32::init_conf(jit_conv_conf_t &jcp,
         const memory_desc_wrapper &diff_dst_d) {
     if (!mayiuse(avx2)) return status::unimplemented;
 
+    jcp = zero<decltype(jcp)>();
+
     const bool with_groups = diff_weights_d.ndims() == src_d.ndims() + 1;
 
     jcp.ngroups = with_groups ? diff_weights_d.dims()[0] : 1;
@@ -119,10 +119,7 @@ void _jit_avx2_convolution_fwd_t<with_relu>::execute_forward() {
         }
     };
 
-#pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 template void _jit_avx2_convolution_fwd_t<true>::execute_forward();
@@ -205,10 +202,7 @@ void jit_avx2_convolution_bwd_data_t::execute_backward_data() {
         }
     };
 
-#pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 void jit_avx2_convolution_bwd_weights_t::execute_backward_weights() {
@@ -312,14 +306,11 @@ void jit_avx2_convolution_bwd_weights_t::execute_backward_weights() {
         rb->reduce(ithr, diff_bias);
     };
 
-#   pragma omp parallel
-    {
-        int ithr = omp_get_thread_num();
-        int nthr = omp_get_num_threads();
+    parallel(0, [&](const int ithr, const int nthr) {
         ker(ithr, nthr);
         if (conf_.with_bias())
             ker_bias(ithr, nthr);
-    }
+    });
 }
 
 }
@@ -23,6 +23,7 @@
 #include "cpu_reducer.hpp"
 #include "jit_primitive_conf.hpp"
 #include "jit_avx2_conv_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 #include "mkldnn_thread.hpp"
 
 namespace mkldnn {
@@ -42,6 +43,11 @@ struct _jit_avx2_convolution_fwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_jit_avx2_convolution_fwd_t<with_relu>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx2>::vlen, 0.7,
+                    conv_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -88,8 +94,11 @@ struct _jit_avx2_convolution_fwd_t: public cpu_primitive_t {
     _jit_avx2_convolution_fwd_t(const pd_t *pd, const input_vector &inputs,
             const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
-    { kernel_ = new jit_avx2_conv_fwd_kernel_f32(conf_.jcp_, *conf_.attr()); }
-    ~_jit_avx2_convolution_fwd_t() { delete kernel_; };
+    {
+        kernel_ = get_shared_kernel<jit_avx2_conv_fwd_kernel_f32>(conf_.jcp_,
+                *conf_.attr());
+    }
+    ~_jit_avx2_convolution_fwd_t() { release_shared_kernel(kernel_); };
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
@@ -119,6 +128,11 @@ struct jit_avx2_convolution_bwd_data_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_avx2_convolution_bwd_data_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx2>::vlen, 0.65,
+                    conv_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -157,8 +171,11 @@ struct jit_avx2_convolution_bwd_data_t: public cpu_primitive_t {
     jit_avx2_convolution_bwd_data_t(const pd_t *pd, const input_vector &inputs,
             const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
-    { kernel_ = new jit_avx2_conv_bwd_data_kernel_f32(conf_.jcp_); }
-    ~jit_avx2_convolution_bwd_data_t() { delete kernel_; };
+    {
+        kernel_ = get_shared_kernel<jit_avx2_conv_bwd_data_kernel_f32>(
+                conf_.jcp_);
+    }
+    ~jit_avx2_convolution_bwd_data_t() { release_shared_kernel(kernel_); };
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
@@ -189,6 +206,11 @@ struct jit_avx2_convolution_bwd_weights_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_avx2_convolution_bwd_weights_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx2>::vlen, 0.55,
+                    conv_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             assert(this->engine()->kind() == engine_kind::cpu);
             bool ok = true
@@ -207,6 +229,26 @@ struct jit_avx2_convolution_bwd_weights_t: public cpu_primitive_t {
                     *this->diff_dst_pd_.desc());
         }
 
+        virtual size_t memory_consumption() const override {
+            typedef cpu_reducer_t<data_type::f32> reducer_t;
+            return reducer_t::space_size(weights_balancer())
+                + (this->with_bias()
+                        ? reducer_t::space_size(bias_balancer()) : 0);
+        }
+
+        reduce_balancer_t weights_balancer() const {
+            const auto &j = jcp_;
+            return reduce_balancer_t(mkldnn_get_max_threads(),
+                    j.kh * j.kw * j.ic_block * j.oc_block,
+                    j.ngroups * j.nb_ic * j.nb_oc, j.mb, max_buffer_size);
+        }
+
+        reduce_balancer_t bias_balancer() const {
+            const auto &j = jcp_;
+            return reduce_balancer_t(mkldnn_get_max_threads(), j.oc_block,
+                    j.ngroups * j.nb_oc, j.mb, max_buffer_size);
+        }
+
         jit_conv_conf_t jcp_;
 
     protected:
@@ -226,6 +268,8 @@ struct jit_avx2_convolution_bwd_weights_t: public cpu_primitive_t {
                 CHECK(this->diff_bias_pd_.set_format(x));
             return status::success;
         }
+
+        static const size_t max_buffer_size = 1<<21; /* just a heuristic */
     };
 
     jit_avx2_convolution_bwd_weights_t(const pd_t *pd,
@@ -233,21 +277,17 @@ struct jit_avx2_convolution_bwd_weights_t: public cpu_primitive_t {
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
         , kernel_(nullptr), reducer_weights_(nullptr), reducer_bias_(nullptr)
     {
-        kernel_ = new jit_avx2_conv_bwd_weights_kernel_f32(conf_.jcp_);
-
-        const int max_threads = omp_get_max_threads();
-        const size_t max_buffer_size = 1<<21; /* just a heuristic */
-        const auto &j = conf_.jcp_;
-        reducer_weights_ = new cpu_reducer_t<data_type::f32>(reduce_balancer_t(
-                    max_threads, j.kh * j.kw * j.ic_block * j.oc_block,
-                    j.ngroups * j.nb_ic * j.nb_oc, j.mb, max_buffer_size));
+        kernel_ = get_shared_kernel<jit_avx2_conv_bwd_weights_kernel_f32>(
+                conf_.jcp_);
+
+        reducer_weights_ = new cpu_reducer_t<data_type::f32>(
+                conf_.weights_balancer());
         if (conf_.with_bias()) {
             reducer_bias_ = new cpu_reducer_t<data_type::f32>(
-                    reduce_balancer_t(max_threads, j.oc_block,
-                        j.ngroups * j.nb_oc, j.mb, max_buffer_size));
+                    conf_.bias_balancer());
         }
     }
-    ~jit_avx2_convolution_bwd_weights_t() { delete kernel_; };
+    ~jit_avx2_convolution_bwd_weights_t() { release_shared_kernel(kernel_); };
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
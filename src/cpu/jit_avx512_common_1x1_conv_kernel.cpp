@@ -667,6 +667,8 @@ status_t jit_avx512_common_1x1_conv_kernel::init_conf(
 {
     if (!mayiuse(avx512_common)) return status::unimplemented;
 
+    jcp = zero<decltype(jcp)>();
+
     const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
 
     jcp.prop_kind = cd.prop_kind;
@@ -931,7 +933,7 @@ status_t jit_avx512_common_1x1_conv_kernel::init_conf(
             jcp.use_vmovntps = false;
         }
         if (jcp.ver == ver_avx512_core && jcp.expl_bcast_) {
-            int nthrs = omp_get_max_threads();
+            int nthrs = mkldnn_get_max_threads();
             float write_data_per_thr = one_of(jcp.prop_kind, forward_training,
                                                forward_inference) ?
                     (float)(sizeof(float)
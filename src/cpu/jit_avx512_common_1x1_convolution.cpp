@@ -85,10 +85,7 @@ void _jit_avx512_common_1x1_convolution_fwd_t
         return remaining < tail_step ? remaining : default_step;
     };
 
-#   pragma omp parallel
-    {
-        int ithr = omp_get_thread_num(), nthr = omp_get_num_threads();
-
+    parallel(0, [&](const int ithr, const int nthr) {
         jit_1x1_conv_call_s p = {};
 
         rtus_driver_t<avx512_common>::call_params_t rp = {};
@@ -246,7 +243,7 @@ void _jit_avx512_common_1x1_convolution_fwd_t
         } else {
             assert(!"unsupported loop order");
         }
-    }
+    });
 }
 
 template struct _jit_avx512_common_1x1_convolution_fwd_t<true, data_type::f32>;
@@ -294,10 +291,7 @@ void _jit_avx512_common_1x1_convolution_bwd_data_t
         return remaining < tail_step ? remaining : default_step;
     };
 
-#   pragma omp parallel
-    {
-        int ithr = omp_get_thread_num(), nthr = omp_get_num_threads();
-
+    parallel(0, [&](const int ithr, const int nthr) {
         jit_1x1_conv_call_s p = {};
         rtus_driver_t<avx512_common>::call_params_t rp = {};
 
@@ -389,7 +383,7 @@ void _jit_avx512_common_1x1_convolution_bwd_data_t
                 }
             }
         }
-    }
+    });
 }
 
 template struct _jit_avx512_common_1x1_convolution_bwd_data_t<data_type::f32>;
@@ -412,7 +406,8 @@ jit_avx512_common_1x1_convolution_bwd_weights_t ::
     , scratch_(nullptr), bctx_(nullptr), tr_src_(nullptr)
     , ws_reduction_(nullptr)
 {
-    kernel_ = new jit_avx512_common_1x1_conv_kernel(conf_.jcp_, *conf_.attr());
+    kernel_ = get_shared_kernel<jit_avx512_common_1x1_conv_kernel>(
+            conf_.jcp_, *conf_.attr());
 
     const auto &jcp = kernel_->jcp;
 
@@ -421,24 +416,18 @@ jit_avx512_common_1x1_convolution_bwd_weights_t ::
     for (int i = 0; i < jcp.nthr_; ++i)
         simple_barrier::ctx_init(&bctx_[i]);
 
-    const int wei_size = jcp.ngroups * jcp.oc * jcp.ic;
-    ws_reduction_ =
-        (data_t *)malloc((jcp.nthr_mb_ - 1) * wei_size * sizeof(data_t), 64);
+    ws_reduction_ = (data_t *)malloc(
+            conf_.ws_reduction_size() * sizeof(data_t), 64);
     acc_ker_ = new cpu_accumulator_1d_t<data_type::f32>();
 
     if (conf_.with_bias()) {
-        const size_t max_buffer_size = jcp.nthr_ * 3 * 5 * 5 * 16 * 16;
         reducer_bias_ = new cpu_reducer_t<data_type::f32>(
-                reduce_balancer_t(jcp.nthr_, jcp.oc_block,
-                        jcp.ngroups * jcp.nb_load, jcp.mb, max_buffer_size));
+                conf_.bias_balancer());
     }
     if (jcp.transpose_src) {
-        const size_t tr_src_size =
-            jcp.nthr_mb_ * jcp.ngroups * jcp.ic * jcp.tr_is;
+        const size_t tr_src_size = conf_.tr_src_size();
         tr_src_ = (data_t *)malloc(tr_src_size * sizeof(data_t), 64);
-#       pragma omp parallel for
-        for (size_t i = 0; i < tr_src_size; i++)
-            tr_src_[i] = 0;
+        parallel_nd(tr_src_size, [&](size_t i) { tr_src_[i] = 0; });
         jit_transpose4x16_src_t tp = {};
         tp.src_pf0_distance = 4;
         tp.tr_src_pf0_distance = 0;
@@ -771,14 +760,12 @@ void jit_avx512_common_1x1_convolution_bwd_weights_t::execute_backward_weights()
         rb->reduce(ithr, diff_bias);
     };
 
-#pragma omp parallel num_threads(jcp.nthr_)
-    {
-        int ithr = omp_get_thread_num();
-        assert(jcp.nthr_ == omp_get_num_threads());
+    parallel(jcp.nthr_, [&](const int ithr, const int nthr) {
+        assert(jcp.nthr_ == nthr);
         ker(ithr, jcp.nthr_);
         if (conf_.with_bias())
             ker_bias(ithr, jcp.nthr_);
-    }
+    });
 }
 
 }
@@ -22,6 +22,7 @@
 #include "cpu_engine.hpp"
 #include "cpu_reducer.hpp"
 #include "jit_avx512_common_1x1_conv_kernel.hpp"
+#include "jit_kernel_cache.hpp"
 #include "jit_uni_1x1_conv_utils.hpp"
 #include "jit_transpose_src_utils.hpp"
 #include "mkldnn_thread.hpp"
@@ -48,6 +49,16 @@ struct _jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_jit_avx512_common_1x1_convolution_fwd_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.8,
+                    conv_flops(this), io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            return mkldnn_get_max_threads() * rtus_ws_per_thread(this)
+                * types::data_type_size(src_type);
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace utils;
@@ -74,7 +85,7 @@ struct _jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
                     *conv_d, *src_d, *this->weights_pd_.desc(),
                     *this->dst_pd_.desc(), *this->attr(),
                     with_relu, this->negative_slope(),
-                    omp_get_max_threads(), rtus_.reduce_src_);
+                    mkldnn_get_max_threads(), rtus_.reduce_src_);
         }
 
         jit_1x1_conv_conf_t jcp_;
@@ -116,12 +127,12 @@ struct _jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
         , kernel_(nullptr), rtus_driver_(nullptr), ws_per_thread_(0)
         , scratch_(nullptr)
     {
-        kernel_ = new jit_avx512_common_1x1_conv_kernel(conf_.jcp_,
-                    *conf_.attr());
+        kernel_ = get_shared_kernel<jit_avx512_common_1x1_conv_kernel>(
+                conf_.jcp_, *conf_.attr());
         init_rtus_driver<avx512_common>(this);
     }
     ~_jit_avx512_common_1x1_convolution_fwd_t() {
-        delete kernel_;
+        release_shared_kernel(kernel_);
         delete rtus_driver_;
         free(scratch_);
     }
@@ -170,6 +181,16 @@ struct _jit_avx512_common_1x1_convolution_bwd_data_t : public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_jit_avx512_common_1x1_convolution_bwd_data_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.75,
+                    conv_flops(this), io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            return mkldnn_get_max_threads() * rtus_ws_per_thread(this)
+                * types::data_type_size(diff_src_type);
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -188,7 +209,7 @@ struct _jit_avx512_common_1x1_convolution_bwd_data_t : public cpu_primitive_t {
             return jit_avx512_common_1x1_conv_kernel::init_conf(jcp_,
                             *conv_d, *diff_src_d, *this->weights_pd_.desc(),
                             *this->diff_dst_pd_.desc(), *this->attr(),
-                            omp_get_max_threads(), rtus_.reduce_src_);
+                            mkldnn_get_max_threads(), rtus_.reduce_src_);
         }
 
         // TODO (Roma): structs conf header cleanup
@@ -233,13 +254,13 @@ struct _jit_avx512_common_1x1_convolution_bwd_data_t : public cpu_primitive_t {
         , kernel_(nullptr), rtus_driver_(nullptr), ws_per_thread_(0)
         , scratch_(nullptr)
     {
-        kernel_ = new jit_avx512_common_1x1_conv_kernel(conf_.jcp_,
-                    *conf_.attr());
+        kernel_ = get_shared_kernel<jit_avx512_common_1x1_conv_kernel>(
+                conf_.jcp_, *conf_.attr());
         init_rtus_driver<avx512_common>(this);
     }
     ~_jit_avx512_common_1x1_convolution_bwd_data_t()
     {
-        delete kernel_;
+        release_shared_kernel(kernel_);
         delete rtus_driver_;
         free(scratch_);
     }
@@ -287,6 +308,38 @@ struct jit_avx512_common_1x1_convolution_bwd_weights_t : public cpu_primitive_t
 
         DECLARE_COMMON_PD_T(jit_avx512_common_1x1_convolution_bwd_weights_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.65,
+                    conv_flops(this), io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            const auto &j = jcp_;
+            return sizeof(float) * (0
+                    + mkldnn_get_max_threads() * rtus_ws_per_thread(this)
+                    + ws_reduction_size()
+                    + (j.transpose_src ? tr_src_size() : 0))
+                + j.nthr_ * sizeof(simple_barrier::ctx_t)
+                + (this->with_bias()
+                        ? cpu_reducer_t<data_type::f32>::space_size(
+                            bias_balancer()) : 0);
+        }
+
+        /* the partial diff weights of the minibatch threads but the first */
+        size_t ws_reduction_size() const {
+            return (jcp_.nthr_mb_ - 1) * jcp_.ngroups * jcp_.oc * jcp_.ic;
+        }
+
+        size_t tr_src_size() const
+        { return jcp_.nthr_mb_ * jcp_.ngroups * jcp_.ic * jcp_.tr_is; }
+
+        reduce_balancer_t bias_balancer() const {
+            const auto &j = jcp_;
+            return reduce_balancer_t(j.nthr_, j.oc_block,
+                    j.ngroups * j.nb_load, j.mb,
+                    j.nthr_ * 3 * 5 * 5 * 16 * 16);
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -299,7 +352,8 @@ struct jit_avx512_common_1x1_convolution_bwd_weights_t : public cpu_primitive_t
                         this->desc()->diff_weights_desc.data_type,
                         this->desc()->diff_dst_desc.data_type)
                 && utils::implication(this->with_bias(),
-                        data_type::f32 == desc()->diff_bias_desc.data_type);
+                        data_type::f32 == desc()->diff_bias_desc.data_type)
+                && MKLDNN_THR_SYNC == 1; /* threads spin on simple_barrier */
             if (!ok) return status::unimplemented;
 
             const convolution_desc_t *conv_d = this->desc();
@@ -308,7 +362,7 @@ struct jit_avx512_common_1x1_convolution_bwd_weights_t : public cpu_primitive_t
             return jit_avx512_common_1x1_conv_kernel::init_conf(jcp_,
                             *conv_d, *src_d, *this->diff_weights_pd_.desc(),
                             *this->diff_dst_pd_.desc(), *this->attr(),
-                            omp_get_max_threads(), rtus_.reduce_src_);
+                            mkldnn_get_max_threads(), rtus_.reduce_src_);
         }
 
         // TODO (Roma): structs conf header cleanup
@@ -342,7 +396,7 @@ struct jit_avx512_common_1x1_convolution_bwd_weights_t : public cpu_primitive_t
                                                  const input_vector &inputs,
                                                  const output_vector &outputs);
     ~jit_avx512_common_1x1_convolution_bwd_weights_t() {
-        delete kernel_;
+        release_shared_kernel(kernel_);
         delete acc_ker_;
         delete reducer_bias_;
         delete rtus_driver_;
@@ -1686,6 +1686,8 @@ status_t jit_avx512_common_conv_bwd_data_kernel_f32::init_conf(
 {
     if (!mayiuse(avx512_common)) return status::unimplemented;
 
+    jcp = zero<decltype(jcp)>();
+
     const bool with_groups = weights_d.ndims() == diff_src_d.ndims() + 1;
 
     jcp.prop_kind = cd.prop_kind;
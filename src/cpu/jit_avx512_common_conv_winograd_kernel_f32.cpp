@@ -199,6 +199,9 @@ using namespace mkldnn::impl::memory_format;
 using namespace mkldnn::impl::utils;
 using namespace Xbyak;
 
+/* alpha is passed by reference to parallel_nd() */
+const int jit_conv_winograd_conf_t::alpha;
+
 void _jit_avx512_common_conv_winograd_data_kernel_f32::gemm_loop_generate(
         bool is_beta_zero)
 {
@@ -354,6 +357,8 @@ status_t _jit_avx512_common_conv_winograd_data_kernel_f32::init_conf_common(
     else
         jcp.ver = ver_fma;
 
+    jcp.nthr = mkldnn_get_max_threads();
+
     const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
     const int simd_w = 16;
 
@@ -438,14 +443,16 @@ status_t set_wsched_DATA_W_SGD(jit_conv_winograd_conf_t &jcp) {
             int dimN_block, int current_best) {
         return check_L2_block_per_thread(jcp, dimN_block, 0.1, 1.3)
             && (dimN_block > current_best)
-            && ((jcp.dimN / dimN_block / jcp.dimN_reg_block) > 2 * omp_get_max_threads());
+            && ((jcp.dimN / dimN_block / jcp.dimN_reg_block)
+                    > 2 * mkldnn_get_max_threads());
     };
 
     jcp.dimN_block = get_divisor_satisfying_cond(
             jcp, jcp.dimN / jcp.dimN_reg_block, 1, test_cond_dimN_block);
 
     if (check_L2_block_per_thread(jcp, jcp.dimN_block, 0.1, 1.3)
-        && jcp.dimN/ jcp.dimN_block/ jcp.dimN_reg_block > 2 * omp_get_max_threads()) {
+        && jcp.dimN/ jcp.dimN_block/ jcp.dimN_reg_block
+                > 2 * mkldnn_get_max_threads()) {
         jcp.dimN_nb_block = jcp.dimN / jcp.dimN_block / jcp.dimN_reg_block;
 
         /* ------------------- L1 blocking for GEMM --------------*/
@@ -1126,7 +1133,7 @@ bool set_wsched_WEI_SDGt_W(jit_conv_winograd_conf_t &jcp)
                 && (jcp.ntiles / tile_block) % tile_block_ur == 0
                 && is_in_L2_range(thread_size, TC2, TC2_max)
                 && is_in_L2_range(L2_reuse, C2, C2_max)
-                && tile_block > T * omp_get_max_threads()
+                && tile_block > T * mkldnn_get_max_threads()
                 && nb_oc_simd_block % nb_oc == 0
                 && nb_ic_simd_block % nb_ic == 0
                 && is_in_L1_range(L1_reuse, C1, C1_max);
@@ -1198,7 +1205,7 @@ bool set_wsched_WEI_SDGtWo(jit_conv_winograd_conf_t &jcp)
                 && (jcp.ntiles / tile_block) % tile_block_ur == 0
                 && is_in_L2_range(thread_size, TC2, TC2_max)
                 && is_in_L2_range(L2_reuse, C2, C2_max)
-                && tile_block > T * omp_get_max_threads()
+                && tile_block > T * mkldnn_get_max_threads()
                 && nb_oc_simd_block % nb_oc == 0
                 && nb_ic_simd_block % nb_ic == 0
                 && is_in_L1_range(L1_reuse, C1, C1_max);
@@ -1261,7 +1268,7 @@ bool set_wsched_WEI_S_D_Giot_W(jit_conv_winograd_conf_t &jcp)
                 && nb_ic_simd_block % nb_ic == 0
                 && is_in_L2_range(L2_reuse, C2, C2_max)
                 && is_in_L1_range(L1_reuse, C1, C1_max)
-                && work_amount > T * omp_get_max_threads();
+                && work_amount > T * mkldnn_get_max_threads();
     };
 
     for (T = T0; T >= T_min; --T) {
@@ -1297,6 +1304,8 @@ status_t jit_avx512_common_conv_winograd_bwd_weights_kernel_f32::init_conf(
     if (!mayiuse(avx512_common))
         return status::unimplemented;
 
+    jcp.nthr = mkldnn_get_max_threads();
+
     const bool with_groups = diff_weights_d.ndims() == src_d.ndims() + 1;
     const int simd_w = 16;
 
@@ -77,10 +77,7 @@ void _jit_avx512_common_convolution_fwd_t
     const auto &jcp = kernel_->jcp;
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
-#   pragma omp parallel
-    {
-        int ithr = omp_get_thread_num(), nthr = omp_get_num_threads();
-
+    parallel(0, [&](const int ithr, const int nthr) {
         int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
         int start, end, start_copy;
         int work_amount = jcp.mb * jcp.ngroups * oc_chunks * jcp.oh;
@@ -159,7 +156,7 @@ void _jit_avx512_common_convolution_fwd_t
 
         jit_conv_ker_pipeline(kernel_->jit_ker, par_conv,
                 src, dst, weights, bias, 0, 0);
-    }
+    });
 }
 template struct _jit_avx512_common_convolution_fwd_t<false, data_type::f32>;
 template struct _jit_avx512_common_convolution_fwd_t<true, data_type::f32>;
@@ -183,10 +180,7 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
 
     const auto &jcp = kernel_->jcp;
 
-#   pragma omp parallel
-    {
-        int ithr = omp_get_thread_num(), nthr = omp_get_num_threads();
-
+    parallel(0, [&](const int ithr, const int nthr) {
         int start, end, start_copy;
         int ic_chunks = jcp.nb_ic / jcp.nb_ic_blocking;
         int work_amount = jcp.ngroups * jcp.mb * ic_chunks * jcp.ih;
@@ -280,7 +274,7 @@ void jit_avx512_common_convolution_bwd_data_t<diff_dst_type, wei_type,
 
         jit_conv_ker_pipeline(kernel_->jit_ker, par_conv,
                 diff_src, diff_dst, weights, 0, 0, 1);
-    }
+    });
 }
 
 template struct jit_avx512_common_convolution_bwd_data_t<data_type::f32>;
@@ -295,25 +289,22 @@ jit_avx512_common_convolution_bwd_weights_t(const pd_t *pd,
     , tr_src_(nullptr), ws_reduction_(nullptr), tr_src_bctx_(nullptr)
 {
     const auto &j = conf_.jcp_;
-    kernel_ = new jit_avx512_common_conv_bwd_weights_kernel_f32(j);
+    kernel_ = get_shared_kernel<jit_avx512_common_conv_bwd_weights_kernel_f32>(
+            j);
 
-    balance();
+    nthr_ = conf_.nthr_;
+    nthr_mb_ = conf_.nthr_mb_;
+    nthr_g_ = conf_.nthr_g_;
+    nthr_oc_b_ = conf_.nthr_oc_b_;
+    nthr_ic_b_ = conf_.nthr_ic_b_;
 
     if (j.ver == ver_4fma) {
         trans_kernel_ = create_trans_src(&j);
 
-        if (j.is_1stconv) {
-            const int tr_src_size =
-                nthr_ / nthr_oc_b_ * j.ih * j.stride_w * j.tr_ld;
-            tr_src_ = (data_t *)malloc(tr_src_size * sizeof(data_t), 64);
-        } else {
-            // XXX: See the comment about tr_iw and guarding elements in
-            // jit_avx512_common_conv_bwd_weights_kernel_f32::init_conf()
-            const int max_nthr = nthr_mb_ * j.ngroups * j.nb_ic;
-            const int min_tr_src_size_per_thr = j.ih * j.ic_block * j.tr_iw;
-            const int tr_src_size = max_nthr * min_tr_src_size_per_thr
-                + j.tr_src_num_guard_elems;
-            tr_src_ = (data_t *)malloc(tr_src_size * sizeof(data_t), 64);
+        tr_src_ = (data_t *)malloc(conf_.tr_src_size() * sizeof(data_t), 64);
+        if (!j.is_1stconv) {
+            const int max_nthr = conf_.max_tr_src_nthr();
+            const int min_tr_src_size_per_thr = conf_.tr_src_size_per_thr();
             /* to avoid NaNs in computations we zero tail num_guard_elems for
              * each possible thread group */
             for (int ithr = 1; ithr <= max_nthr; ++ithr) {
@@ -325,7 +316,7 @@ jit_avx512_common_convolution_bwd_weights_t(const pd_t *pd,
 
         /* prepare synchronization contexts */
         if (nthr_oc_b_ > 1) {
-            const int tr_src_bctx_size = nthr_ / nthr_oc_b_;
+            const int tr_src_bctx_size = conf_.tr_src_bctx_size();
             tr_src_bctx_ = (simple_barrier::ctx_t *)malloc(
                     tr_src_bctx_size * sizeof(simple_barrier::ctx_t), 64);
             for (int i = 0; i < tr_src_bctx_size; ++i)
@@ -334,19 +325,15 @@ jit_avx512_common_convolution_bwd_weights_t(const pd_t *pd,
     }
 
     if (nthr_mb_ > 1) {
-        const int wei_size = j.ngroups * j.oc * j.ic * j.kh * j.kw;
-        const int bia_size = j.ngroups * j.oc;
         ws_reduction_ = (data_t *)malloc(
-                (nthr_mb_ - 1) * (wei_size + bia_size) * sizeof(data_t), 64);
+                conf_.ws_reduction_size() * sizeof(data_t), 64);
         acc_ker_ = new cpu_accumulator_1d_t<data_type::f32>();
         simple_barrier::ctx_init(&reduction_bctx_);
     }
 
     if (conf_.with_bias()) {
-        const size_t max_buffer_size = nthr_ * 3 * 5 * 5 * 16 * 16;
-        reducer_bias_ = new cpu_reducer_t<data_type::f32>(reduce_balancer_t(
-                    nthr_, j.oc_block, j.ngroups * j.nb_oc, j.mb,
-                    max_buffer_size));
+        reducer_bias_ = new cpu_reducer_t<data_type::f32>(
+                conf_.bias_balancer());
     }
 }
 
@@ -574,8 +561,6 @@ void jit_avx512_common_convolution_bwd_weights_t::reduce_diff_weights(
     const data_t *diff_bias_ws = ws_reduction_ + (nthr_mb_ - 1) * wei_size;
 
     /* diff_weights[:] += sum(ws_reduction_[thr_mb][:]) */
-    simple_barrier::barrier(&reduction_bctx_, nthr_);
-
     const int ic_b_kh_work = ti->ic_b_work * jcp.kh;
     const int work = ti->g_work * ti->oc_b_work * ic_b_kh_work;
 
@@ -669,25 +654,44 @@ void jit_avx512_common_convolution_bwd_weights_t::compute_diff_bias(
 }
 
 void jit_avx512_common_convolution_bwd_weights_t::execute_backward_weights() {
-#   pragma omp parallel num_threads(nthr_)
-    {
-        int ithr = omp_get_thread_num();
-        assert(nthr_ == omp_get_num_threads());
+#if MKLDNN_THR_SYNC == 1
+    parallel(nthr_, [&](const int ithr, const int nthr) {
+        assert(nthr_ == nthr);
 
         thread_info_t thread_info(this, ithr);
 
         compute_diff_weights(&thread_info);
-        if (nthr_mb_ > 1)
+        if (nthr_mb_ > 1) {
+            simple_barrier::barrier(&reduction_bctx_, nthr_);
             reduce_diff_weights(&thread_info);
+        }
 
         if (conf_.with_bias())
             compute_diff_bias(&thread_info);
-    }
+    });
+#else
+    /* the threads cannot wait for each other, so the reduction over
+     * minibatch starts once all the partial diff_weights are computed */
+    parallel(nthr_, [&](const int ithr, const int nthr) {
+        assert(nthr_ == nthr);
+        thread_info_t thread_info(this, ithr);
+        compute_diff_weights(&thread_info);
+    });
+
+    parallel(nthr_, [&](const int ithr, const int nthr) {
+        assert(nthr_ == nthr);
+        thread_info_t thread_info(this, ithr);
+        if (nthr_mb_ > 1)
+            reduce_diff_weights(&thread_info);
+        if (conf_.with_bias())
+            compute_diff_bias(&thread_info);
+    });
+#endif
 }
 
-void jit_avx512_common_convolution_bwd_weights_t::balance() {
-    const int max_threads = omp_get_max_threads();
-    const auto &j = conf_.jcp_;
+void jit_avx512_common_convolution_bwd_weights_t::pd_t::balance() {
+    const int max_threads = mkldnn_get_max_threads();
+    const auto &j = jcp_;
 
     nthr_ = nthr_mb_ = nthr_g_ = nthr_oc_b_ = nthr_ic_b_ = 1;
 
@@ -708,6 +712,11 @@ void jit_avx512_common_convolution_bwd_weights_t::balance() {
     nthr_g_ = j.ngroups;
     const int nthr = max_threads / nthr_g_;
 
+    /* the threads sharing transposed src wait for each other (see
+     * compute_diff_weights()), which is possible only if MKLDNN_THR_SYNC */
+    const int nb_oc_par = MKLDNN_THR_SYNC == 0 && j.ver == ver_4fma
+        ? 1 : j.nb_oc;
+
     auto calc_mem_cost = [=](int nthr_mb, int nthr_oc_b, int nthr_ic_b) {
         /* calculate per thread memory cost (read/write). high level optimizer
          * tries to minimize memory consumption. few notes:
@@ -742,7 +751,7 @@ void jit_avx512_common_convolution_bwd_weights_t::balance() {
     const int nthr_mb_max = nstl::min(nthr, j.mb);
     for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
         const int nthr_par = nthr / nthr_mb;
-        const int nthr_oc_b_max = nstl::min(nthr_par, j.nb_oc);
+        const int nthr_oc_b_max = nstl::min(nthr_par, nb_oc_par);
         for (int nthr_oc_b = 1; nthr_oc_b <= nthr_oc_b_max; ++nthr_oc_b) {
             int nthr_ic_b = nstl::min(nthr_par / nthr_oc_b, j.nb_ic);
             int mem_cost = calc_mem_cost(nthr_mb, nthr_oc_b, nthr_ic_b);
@@ -772,7 +781,7 @@ void jit_avx512_common_convolution_bwd_weights_t::balance() {
         int best_comp_cost = calc_comp_cost(nthr_mb_, nthr_oc_b_, nthr_ic_b_);
         for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
             const int nthr_par = nthr / nthr_mb;
-            const int nthr_oc_b_max = nstl::min(nthr_par, j.nb_oc);
+            const int nthr_oc_b_max = nstl::min(nthr_par, nb_oc_par);
             for (int nthr_oc_b = 1; nthr_oc_b <= nthr_oc_b_max; ++nthr_oc_b) {
                 int nthr_ic_b = nstl::min(nthr_par / nthr_oc_b, j.nb_ic);
                 int mem_cost = calc_mem_cost(nthr_mb, nthr_oc_b, nthr_ic_b);
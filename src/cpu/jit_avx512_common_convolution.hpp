@@ -21,6 +21,7 @@
 #include "cpu_convolution_pd.hpp"
 #include "cpu_engine.hpp"
 #include "jit_avx512_common_conv_kernel.hpp"
+#include "jit_kernel_cache.hpp"
 #include "jit_transpose_src_utils.hpp"
 #include "cpu_reducer.hpp"
 #include "cpu_barrier.hpp"
@@ -45,6 +46,11 @@ struct _jit_avx512_common_convolution_fwd_t : public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_jit_avx512_common_convolution_fwd_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.75,
+                    conv_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override
         {
             using namespace prop_kind;
@@ -78,10 +84,11 @@ struct _jit_avx512_common_convolution_fwd_t : public cpu_primitive_t {
             const input_vector &inputs, const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
     {
-        kernel_ = new jit_avx512_common_conv_fwd_kernel(conf_.jcp_,
-                    *conf_.attr());
+        kernel_ = get_shared_kernel<jit_avx512_common_conv_fwd_kernel>(
+                conf_.jcp_, *conf_.attr());
     }
-    ~_jit_avx512_common_convolution_fwd_t() { delete kernel_; };
+    ~_jit_avx512_common_convolution_fwd_t()
+    { release_shared_kernel(kernel_); };
 
     typedef typename prec_traits<src_type>::type src_data_t;
     typedef typename prec_traits<wei_type>::type wei_data_t;
@@ -124,6 +131,11 @@ struct jit_avx512_common_convolution_bwd_data_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_avx512_common_convolution_bwd_data_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.7,
+                    conv_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -171,8 +183,12 @@ struct jit_avx512_common_convolution_bwd_data_t: public cpu_primitive_t {
     jit_avx512_common_convolution_bwd_data_t(const pd_t *pd,
             const input_vector &inputs, const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
-    { kernel_ = new jit_avx512_common_conv_bwd_data_kernel_f32(conf_.jcp_); }
-    ~jit_avx512_common_convolution_bwd_data_t() { delete kernel_; };
+    {
+        kernel_ = get_shared_kernel<jit_avx512_common_conv_bwd_data_kernel_f32>(
+                conf_.jcp_);
+    }
+    ~jit_avx512_common_convolution_bwd_data_t()
+    { release_shared_kernel(kernel_); };
 
     typedef typename prec_traits<diff_dst_type>::type diff_dst_data_t;
     typedef typename prec_traits<wei_type>::type wei_data_t;
@@ -201,10 +217,63 @@ struct jit_avx512_common_convolution_bwd_weights_t: public cpu_primitive_t {
                 const primitive_attr_t *attr,
                 const convolution_fwd_pd_t *hint_fwd_pd)
             : cpu_convolution_bwd_weights_pd_t(engine, adesc, attr, hint_fwd_pd)
-            , jcp_({}) {}
+            , jcp_({}), nthr_(1), nthr_mb_(1), nthr_g_(1), nthr_oc_b_(1)
+            , nthr_ic_b_(1) {}
 
         DECLARE_COMMON_PD_T(jit_avx512_common_convolution_bwd_weights_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.6,
+                    conv_flops(this), io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            size_t size = 0;
+            if (jcp_.ver == ver_4fma) {
+                size += tr_src_size() * sizeof(float);
+                if (nthr_oc_b_ > 1)
+                    size += tr_src_bctx_size() * sizeof(simple_barrier::ctx_t);
+            }
+            if (nthr_mb_ > 1)
+                size += ws_reduction_size() * sizeof(float);
+            if (this->with_bias())
+                size += cpu_reducer_t<data_type::f32>::space_size(
+                        bias_balancer());
+            return size;
+        }
+
+        size_t tr_src_size() const {
+            const auto &j = jcp_;
+            if (j.is_1stconv)
+                return nthr_ / nthr_oc_b_ * j.ih * j.stride_w * j.tr_ld;
+            /* XXX: See the comment about tr_iw and guarding elements in
+             * jit_avx512_common_conv_bwd_weights_kernel_f32::init_conf() */
+            return max_tr_src_nthr() * tr_src_size_per_thr()
+                + j.tr_src_num_guard_elems;
+        }
+
+        int max_tr_src_nthr() const
+        { return nthr_mb_ * jcp_.ngroups * jcp_.nb_ic; }
+
+        size_t tr_src_size_per_thr() const
+        { return jcp_.ih * jcp_.ic_block * jcp_.tr_iw; }
+
+        int tr_src_bctx_size() const { return nthr_ / nthr_oc_b_; }
+
+        /* the partial diff weights and bias of the minibatch threads but
+         * the first */
+        size_t ws_reduction_size() const {
+            const auto &j = jcp_;
+            return (nthr_mb_ - 1) * (j.ngroups * j.oc * j.ic * j.kh * j.kw
+                    + j.ngroups * j.oc);
+        }
+
+        reduce_balancer_t bias_balancer() const {
+            const auto &j = jcp_;
+            return reduce_balancer_t(nthr_, j.oc_block, j.ngroups * j.nb_oc,
+                    j.mb, nthr_ * 3 * 5 * 5 * 16 * 16);
+        }
+
         virtual status_t init() override {
             assert(this->engine()->kind() == engine_kind::cpu);
             bool ok = true
@@ -216,18 +285,27 @@ struct jit_avx512_common_convolution_bwd_weights_t: public cpu_primitive_t {
                         this->desc()->diff_weights_desc.data_type);
             if (!ok) return status::unimplemented;
 
-            return jit_avx512_common_conv_bwd_weights_kernel_f32::init_conf(
+            status_t status =
+                jit_avx512_common_conv_bwd_weights_kernel_f32::init_conf(
                     jcp_, *this->desc(), this->src_pd_, this->diff_weights_pd_,
                     this->diff_bias_pd_, this->diff_dst_pd_);
+            if (status != status::success) return status;
+
+            balance();
+            return status::success;
         }
 
         jit_conv_conf_t jcp_;
+        int nthr_, nthr_mb_, nthr_g_, nthr_oc_b_, nthr_ic_b_;
+
+    private:
+        void balance();
     };
 
     jit_avx512_common_convolution_bwd_weights_t(const pd_t *pd,
             const input_vector &inputs, const output_vector &outputs);
     ~jit_avx512_common_convolution_bwd_weights_t() {
-        delete kernel_;
+        release_shared_kernel(kernel_);
         if (trans_kernel_)
             delete trans_kernel_;
         if (acc_ker_)
@@ -249,7 +327,6 @@ struct jit_avx512_common_convolution_bwd_weights_t: public cpu_primitive_t {
 
 private:
     void execute_backward_weights();
-    void balance();
 
     struct thread_info_t;
     void compute_diff_weights(const thread_info_t *);
@@ -1389,84 +1389,57 @@ _execute_forward_W_S_G_D()
     bool V_streamout = jcp.ntiles * jcp.ic * alpha * alpha * sizeof(float)
         > 2 * LLC_cache_size ? true : false;
 
-#pragma omp parallel
-    {
-#pragma omp for nowait collapse(3)
-        for (int img = 0; img < jcp.mb; img++) {
-            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                    src_transform_fwd(img, jcp,
-                            &(src(img, ifm1 * jcp.ic_block + ifm2, 0, 0, 0)),
-                            &(V(0, 0, 0, 0, ifm1, ifm2, 0, 0)), V_streamout);
-                }
-            }
-        }
-
-#pragma omp for nowait collapse(4)
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                    for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                        weight_transform_fwd(jcp,
-                                &(weights(ofm1 * jcp.oc_block + ofm2,
-                                        ifm1 * jcp.ic_block + ifm2,
-                                        0, 0, 0, 0)),
-                                &(U(ofm1, 0, 0, ifm1, ofm2, ifm2, 0, 0)));
-                    }
-                }
-            }
-        }
-
-#pragma omp barrier
-#pragma omp for collapse(5) nowait schedule(static)
-        for (int tile_block = 0; tile_block < jcp.tile_block; tile_block++) {
-            for (int oj = 0; oj < alpha; oj++) {
-                for (int oi = 0; oi < alpha; oi++) {
-                    for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-                        for (int nb_tile_block_ur = 0;
-                                nb_tile_block_ur < jcp.nb_tile_block_ur;
-                                nb_tile_block_ur++) {
-                            kernel_->gemm_loop_ker_first_iter(
-                                    (float *)&(M(tile_block, ofm1,
-                                            oj, oi,
-                                            nb_tile_block_ur, 0,
-                                            0, 0)),
-                                    (const float *)&(U(ofm1, oj, oi, 0,
-                                            0, 0, 0, 0)),
-                                    (const float *)&(V(tile_block, oj, oi,
-                                            nb_tile_block_ur, 0,
-                                            0, 0, 0)));
-                            for (int ifm1 = 1; ifm1 < jcp.nb_ic; ifm1++) {
-                                kernel_->gemm_loop_ker(
-                                        (float *)&(M(tile_block, ofm1,
-                                                oj, oi,
-                                                nb_tile_block_ur, 0,
-                                                0, 0)),
-                                        (const float *)&(U(ofm1, oj, oi, ifm1,
-                                                0, 0, 0, 0)),
-                                        (const float *)&(V(tile_block, oj, oi,
-                                                nb_tile_block_ur, ifm1,
-                                                0, 0, 0)));
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-#pragma omp barrier
-#pragma omp for collapse(3)
-        for (int img = 0; img < jcp.mb; img++) {
-            for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                    output_transform(img, jcp,
-                            &(M(0, ofm1, 0, 0, 0, ofm2, 0, 0)),
-                            &(dst(img, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
-                            &(bias(ofm1 * jcp.oc_block + ofm2, 0)), true);
-                }
-            }
-        }
-    }
+    parallel_nd(jcp.mb, jcp.nb_ic, jcp.ic_block,
+            [&](int img, int ifm1, int ifm2) {
+        src_transform_fwd(img, jcp,
+                &(src(img, ifm1 * jcp.ic_block + ifm2, 0, 0, 0)),
+                &(V(0, 0, 0, 0, ifm1, ifm2, 0, 0)), V_streamout);
+    });
+
+    parallel_nd(jcp.nb_oc, jcp.nb_ic, jcp.oc_block, jcp.ic_block,
+            [&](int ofm1, int ifm1, int ofm2, int ifm2) {
+        weight_transform_fwd(jcp,
+                &(weights(ofm1 * jcp.oc_block + ofm2,
+                        ifm1 * jcp.ic_block + ifm2,
+                        0, 0, 0, 0)),
+                &(U(ofm1, 0, 0, ifm1, ofm2, ifm2, 0, 0)));
+    });
+
+    parallel_nd(jcp.tile_block, alpha, alpha, jcp.nb_oc,
+            jcp.nb_tile_block_ur,
+            [&](int tile_block, int oj, int oi, int ofm1,
+                int nb_tile_block_ur) {
+        kernel_->gemm_loop_ker_first_iter(
+                (float *)&(M(tile_block, ofm1,
+                        oj, oi,
+                        nb_tile_block_ur, 0,
+                        0, 0)),
+                (const float *)&(U(ofm1, oj, oi, 0,
+                        0, 0, 0, 0)),
+                (const float *)&(V(tile_block, oj, oi,
+                        nb_tile_block_ur, 0,
+                        0, 0, 0)));
+        for (int ifm1 = 1; ifm1 < jcp.nb_ic; ifm1++) {
+            kernel_->gemm_loop_ker(
+                    (float *)&(M(tile_block, ofm1,
+                            oj, oi,
+                            nb_tile_block_ur, 0,
+                            0, 0)),
+                    (const float *)&(U(ofm1, oj, oi, ifm1,
+                            0, 0, 0, 0)),
+                    (const float *)&(V(tile_block, oj, oi,
+                            nb_tile_block_ur, ifm1,
+                            0, 0, 0)));
+        }
+    });
+
+    parallel_nd(jcp.mb, jcp.nb_oc, jcp.oc_block,
+            [&](int img, int ofm1, int ofm2) {
+        output_transform(img, jcp,
+                &(M(0, ofm1, 0, 0, 0, ofm2, 0, 0)),
+                &(dst(img, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
+                &(bias(ofm1 * jcp.oc_block + ofm2, 0)), true);
+    });
 }
 
 template <bool with_relu>
@@ -1506,73 +1479,64 @@ _execute_forward_W_SGD()
             0, alpha, alpha, jcp.nb_tile_block_ur, jcp.nb_ic,
             jcp.ic_block, jcp.tile_block_ur, simd_w);
 
-#pragma omp parallel
-    {
-#pragma omp for collapse(4) schedule(static)
-    for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
+    parallel_nd(jcp.nb_oc, jcp.nb_ic, jcp.oc_block, jcp.ic_block,
+            [&](int ofm1, int ifm1, int ofm2, int ifm2) {
+        weight_transform_fwd(jcp,
+                &(weights(ofm1 * jcp.oc_block + ofm2,
+                        ifm1 * jcp.ic_block + ifm2,
+                        0, 0, 0, 0)),
+                &(U(ofm1, 0, 0, ifm1, ofm2, ifm2, 0, 0)));
+    });
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        for_nd(ithr, nthr, jcp.tile_block, [&](int tile_block) {
+            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
                 for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                    weight_transform_fwd(jcp,
-                            &(weights(ofm1 * jcp.oc_block + ofm2,
-                                    ifm1 * jcp.ic_block + ifm2,
-                                    0, 0, 0, 0)),
-                            &(U(ofm1, 0, 0, ifm1, ofm2, ifm2, 0, 0)));
+                    src_transform_fwd_tile(
+                            tile_block, jcp,
+                            &(src(0, ifm1 * jcp.ic_block + ifm2, 0, 0, 0)),
+                            &(V(ithr, 0, 0, 0, ifm1, ifm2, 0, 0)));
                 }
             }
-        }
-    }
 
-#pragma omp for schedule(static)
-    for (int tile_block = 0; tile_block < jcp.tile_block; tile_block++) {
-        int ithr = omp_get_thread_num();
-
-        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-            for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                src_transform_fwd_tile(
-                        tile_block, jcp,
-                        &(src(0, ifm1 * jcp.ic_block + ifm2, 0, 0, 0)),
-                        &(V(ithr, 0, 0, 0, ifm1, ifm2, 0, 0)));
-            }
-        }
-
-        for (int oj = 0; oj < alpha; oj++) {
-            for (int oi = 0; oi < alpha; oi++) {
-                for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-                    for (int nb_tile_block_ur = 0;
-                            nb_tile_block_ur < jcp.nb_tile_block_ur;
-                            nb_tile_block_ur++) {
-                        kernel_->gemm_loop_ker_first_iter(
-                                (float *)&(M(ithr, ofm1, oj, oi,
-                                        nb_tile_block_ur, 0, 0, 0)),
-                                (const float *)&(U(ofm1, oj, oi, 0,
-                                        0, 0, 0, 0)),
-                                (const float *)&(V(ithr, oj, oi,
-                                        nb_tile_block_ur, 0, 0, 0, 0)));
-                        for (int ifm1 = 1; ifm1 < jcp.nb_ic; ifm1++) {
-                            kernel_->gemm_loop_ker(
+            for (int oj = 0; oj < alpha; oj++) {
+                for (int oi = 0; oi < alpha; oi++) {
+                    for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
+                        for (int nb_tile_block_ur = 0;
+                                nb_tile_block_ur < jcp.nb_tile_block_ur;
+                                nb_tile_block_ur++) {
+                            kernel_->gemm_loop_ker_first_iter(
                                     (float *)&(M(ithr, ofm1, oj, oi,
                                             nb_tile_block_ur, 0, 0, 0)),
-                                    (const float *)&(U(ofm1, oj, oi, ifm1,
+                                    (const float *)&(U(ofm1, oj, oi, 0,
                                             0, 0, 0, 0)),
                                     (const float *)&(V(ithr, oj, oi,
-                                            nb_tile_block_ur, ifm1, 0, 0, 0)));
+                                            nb_tile_block_ur, 0, 0, 0, 0)));
+                            for (int ifm1 = 1; ifm1 < jcp.nb_ic; ifm1++) {
+                                kernel_->gemm_loop_ker(
+                                        (float *)&(M(ithr, ofm1, oj, oi,
+                                                nb_tile_block_ur, 0, 0, 0)),
+                                        (const float *)&(U(ofm1, oj, oi, ifm1,
+                                                0, 0, 0, 0)),
+                                        (const float *)&(V(ithr, oj, oi,
+                                                nb_tile_block_ur, ifm1,
+                                                0, 0, 0)));
+                            }
                         }
                     }
                 }
             }
-        }
 
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                output_transform_tile(tile_block, jcp,
-                        &(M(ithr, ofm1, 0, 0, 0, ofm2, 0, 0)),
-                        &(dst(0, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
-                        &(bias(ofm1 * jcp.oc_block + ofm2, 0)));
+            for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
+                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
+                    output_transform_tile(tile_block, jcp,
+                            &(M(ithr, ofm1, 0, 0, 0, ofm2, 0, 0)),
+                            &(dst(0, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
+                            &(bias(ofm1 * jcp.oc_block + ofm2, 0)));
+                }
             }
-        }
-    }
-    }
+        });
+    });
 }
 
 template void
@@ -1617,87 +1581,60 @@ _execute_backward_data_W_S_G_D()
     bool M_streamout = jcp.ntiles * jcp.oc * alpha * alpha * sizeof(float)
         > 2 * LLC_cache_size ? true : false;
 
-#pragma omp parallel
-    {
-#pragma omp for collapse(3) nowait
-        for (int img = 0; img < jcp.mb; img++) {
-            for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                    diff_dst_transform_bwd_data(img, jcp,
-                            &(diff_dst(img, ofm1 * jcp.oc_block + ofm2,
-                                    0, 0, 0)),
-                            &(M(0, 0, 0, 0, ofm1, ofm2, 0, 0)), M_streamout);
-                }
-            }
-        }
-
-#pragma omp for collapse(4) nowait
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                    for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                        weight_transform_bwd_data(jcp,
-                                &(weights(ofm1 * jcp.oc_block + ofm2,
-                                        ifm1 * jcp.ic_block + ifm2,
-                                        0, 0, 0, 0)),
-                                &(U(0, 0, ifm1, ofm1, ifm2, ofm2, 0, 0)));
-                    }
-                }
-            }
-        }
-
-#pragma omp barrier
-#pragma omp for collapse(5) nowait schedule(static)
-        for (int tile_block = 0; tile_block < jcp.tile_block; tile_block++) {
-            for (int oj = 0; oj < alpha; oj++) {
-                for (int oi = 0; oi < alpha; oi++) {
-                    for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-                        for (int nb_tile_block_ur = 0;
-                                nb_tile_block_ur < jcp.nb_tile_block_ur;
-                                nb_tile_block_ur++) {
-                            kernel_->gemm_loop_ker_first_iter(
-                                    (float *)&(V(tile_block, ifm1,
-                                            oj, oi,
-                                            nb_tile_block_ur, 0,
-                                            0, 0)),
-                                    (const float *)&(U(oj, oi,
-                                            ifm1, 0,
-                                            0, 0, 0, 0)),
-                                    (const float *)&(M(tile_block, oj, oi,
-                                            nb_tile_block_ur, 0,
-                                            0, 0, 0)));
-                            for (int ofm1 = 1; ofm1 < jcp.nb_oc; ofm1++) {
-                                kernel_->gemm_loop_ker(
-                                        (float *)&(V(tile_block, ifm1,
-                                                oj, oi,
-                                                nb_tile_block_ur, 0,
-                                                0, 0)),
-                                        (const float *)&(U(oj, oi,
-                                                ifm1, ofm1,
-                                                0, 0, 0, 0)),
-                                        (const float *)&(M(tile_block, oj, oi,
-                                                nb_tile_block_ur, ofm1,
-                                                0, 0, 0)));
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-#pragma omp barrier
-#pragma omp for collapse(3)
-        for (int img = 0; img < jcp.mb; img++) {
-            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                    diff_src_transform_bwd_data(img, jcp,
-                            &(V(0, ifm1, 0, 0, 0, ifm2, 0, 0)),
-                            &(diff_src(img, ifm1 * jcp.ic_block + ifm2,
-                                    0, 0, 0)));
-                }
-            }
-        }
-    }
+    parallel_nd(jcp.mb, jcp.nb_oc, jcp.oc_block,
+            [&](int img, int ofm1, int ofm2) {
+        diff_dst_transform_bwd_data(img, jcp,
+                &(diff_dst(img, ofm1 * jcp.oc_block + ofm2,
+                        0, 0, 0)),
+                &(M(0, 0, 0, 0, ofm1, ofm2, 0, 0)), M_streamout);
+    });
+
+    parallel_nd(jcp.nb_oc, jcp.nb_ic, jcp.oc_block, jcp.ic_block,
+            [&](int ofm1, int ifm1, int ofm2, int ifm2) {
+        weight_transform_bwd_data(jcp,
+                &(weights(ofm1 * jcp.oc_block + ofm2,
+                        ifm1 * jcp.ic_block + ifm2,
+                        0, 0, 0, 0)),
+                &(U(0, 0, ifm1, ofm1, ifm2, ofm2, 0, 0)));
+    });
+
+    parallel_nd(jcp.tile_block, alpha, alpha, jcp.nb_ic,
+            jcp.nb_tile_block_ur,
+            [&](int tile_block, int oj, int oi, int ifm1,
+                int nb_tile_block_ur) {
+        kernel_->gemm_loop_ker_first_iter(
+                (float *)&(V(tile_block, ifm1,
+                        oj, oi,
+                        nb_tile_block_ur, 0,
+                        0, 0)),
+                (const float *)&(U(oj, oi,
+                        ifm1, 0,
+                        0, 0, 0, 0)),
+                (const float *)&(M(tile_block, oj, oi,
+                        nb_tile_block_ur, 0,
+                        0, 0, 0)));
+        for (int ofm1 = 1; ofm1 < jcp.nb_oc; ofm1++) {
+            kernel_->gemm_loop_ker(
+                    (float *)&(V(tile_block, ifm1,
+                            oj, oi,
+                            nb_tile_block_ur, 0,
+                            0, 0)),
+                    (const float *)&(U(oj, oi,
+                            ifm1, ofm1,
+                            0, 0, 0, 0)),
+                    (const float *)&(M(tile_block, oj, oi,
+                            nb_tile_block_ur, ofm1,
+                            0, 0, 0)));
+        }
+    });
+
+    parallel_nd(jcp.mb, jcp.nb_ic, jcp.ic_block,
+            [&](int img, int ifm1, int ifm2) {
+        diff_src_transform_bwd_data(img, jcp,
+                &(V(0, ifm1, 0, 0, 0, ifm2, 0, 0)),
+                &(diff_src(img, ifm1 * jcp.ic_block + ifm2,
+                        0, 0, 0)));
+    });
 }
 
 void jit_avx512_common_convolution_winograd_bwd_data_t::
@@ -1731,72 +1668,64 @@ _execute_backward_data_W_SGD()
             jcp.nb_tile_block_ur, jcp.nb_oc,
             jcp.oc_block, jcp.tile_block_ur, simd_w);
 
-#pragma omp parallel
-    {
-#pragma omp for collapse(4) schedule(static)
-    for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                    weight_transform_bwd_data(jcp,
-                            &(weights(ofm1 * jcp.oc_block + ofm2,
-                                    ifm1 * jcp.ic_block + ifm2,
-                                    0, 0, 0, 0)),
-                            &(U(0, 0, ifm1, ofm1, ifm2, ofm2, 0, 0)));
+    parallel_nd(jcp.nb_ic, jcp.nb_oc, jcp.oc_block, jcp.ic_block,
+            [&](int ifm1, int ofm1, int ofm2, int ifm2) {
+        weight_transform_bwd_data(jcp,
+                &(weights(ofm1 * jcp.oc_block + ofm2,
+                        ifm1 * jcp.ic_block + ifm2,
+                        0, 0, 0, 0)),
+                &(U(0, 0, ifm1, ofm1, ifm2, ofm2, 0, 0)));
+    });
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        for_nd(ithr, nthr, jcp.tile_block, [&](int tile_block) {
+            for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
+                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
+                    diff_dst_transform_bwd_data_tile(
+                            tile_block, jcp,
+                            &(diff_dst(0, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
+                            &(M(ithr, 0, 0, 0, ofm1, ofm2, 0, 0)));
                 }
             }
-        }
-    }
-
-#pragma omp for schedule(static)
-    for (int tile_block = 0; tile_block < jcp.tile_block; tile_block++) {
-        int ithr = omp_get_thread_num();
-
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                diff_dst_transform_bwd_data_tile(
-                        tile_block, jcp,
-                        &(diff_dst(0, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
-                        &(M(ithr, 0, 0, 0, ofm1, ofm2, 0, 0)));
-            }
-        }
 
-        for (int oj = 0; oj < alpha; oj++) {
-            for (int oi = 0; oi < alpha; oi++) {
-                for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-                    for (int nb_tile_block_ur = 0;
-                            nb_tile_block_ur < jcp.nb_tile_block_ur;
-                            nb_tile_block_ur++) {
-                        kernel_->gemm_loop_ker_first_iter(
-                                (float *)&(V(ithr, ifm1, oj, oi,
-                                        nb_tile_block_ur, 0, 0, 0)),
-                                (const float *)&(U(oj, oi,
-                                        ifm1, 0, 0, 0, 0, 0)),
-                                (const float *)&(M(ithr, oj, oi,
-                                        nb_tile_block_ur, 0, 0, 0, 0)));
-                        for (int ofm1 = 1; ofm1 < jcp.nb_oc; ofm1++) {
-                            kernel_->gemm_loop_ker(
+            for (int oj = 0; oj < alpha; oj++) {
+                for (int oi = 0; oi < alpha; oi++) {
+                    for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
+                        for (int nb_tile_block_ur = 0;
+                                nb_tile_block_ur < jcp.nb_tile_block_ur;
+                                nb_tile_block_ur++) {
+                            kernel_->gemm_loop_ker_first_iter(
                                     (float *)&(V(ithr, ifm1, oj, oi,
                                             nb_tile_block_ur, 0, 0, 0)),
                                     (const float *)&(U(oj, oi,
-                                            ifm1, ofm1, 0, 0, 0, 0)),
+                                            ifm1, 0, 0, 0, 0, 0)),
                                     (const float *)&(M(ithr, oj, oi,
-                                            nb_tile_block_ur, ofm1, 0, 0, 0)));
+                                            nb_tile_block_ur, 0, 0, 0, 0)));
+                            for (int ofm1 = 1; ofm1 < jcp.nb_oc; ofm1++) {
+                                kernel_->gemm_loop_ker(
+                                        (float *)&(V(ithr, ifm1, oj, oi,
+                                                nb_tile_block_ur, 0, 0, 0)),
+                                        (const float *)&(U(oj, oi,
+                                                ifm1, ofm1, 0, 0, 0, 0)),
+                                        (const float *)&(M(ithr, oj, oi,
+                                                nb_tile_block_ur, ofm1,
+                                                0, 0, 0)));
+                            }
                         }
                     }
                 }
             }
-        }
 
-        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-            for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                diff_src_transform_bwd_data_tile(tile_block, jcp,
-                        &(V(ithr, ifm1, 0, 0, 0, ifm2, 0, 0)),
-                        &(diff_src(0, ifm1 * jcp.ic_block + ifm2, 0, 0, 0)));
+            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
+                for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
+                    diff_src_transform_bwd_data_tile(tile_block, jcp,
+                            &(V(ithr, ifm1, 0, 0, 0, ifm2, 0, 0)),
+                            &(diff_src(0, ifm1 * jcp.ic_block + ifm2,
+                                    0, 0, 0)));
+                }
             }
-        }
-    }
-    }
+        });
+    });
 }
 
 void jit_avx512_common_convolution_winograd_bwd_weights_t::
@@ -1851,124 +1780,93 @@ _execute_backward_weights_S_D_G_W()
 
     array_offset_calculator<float, 2> diff_bias_prv(
             (float *)(scratchpad_->bias_ptr()),
-            omp_get_max_threads(),
+            nthreads,
             jcp.oc);
 
-#pragma omp parallel num_threads(nthreads)
-    {
-        if (jcp.with_bias) {
-#pragma omp for nowait collapse(2)
-            for (int ithr = 0; ithr < nthreads; ithr++) {
-                for (int ofm = 0; ofm < jcp.oc; ofm++) {
-                    diff_bias_prv(ithr, ofm) = 0.0f;
-                }
-            }
+    if (jcp.with_bias) {
+        parallel_nd(nthreads, jcp.oc, [&](int ithr, int ofm) {
+            diff_bias_prv(ithr, ofm) = 0.0f;
+        });
 
-#pragma omp for nowait
-            for (int bofm = 0; bofm < jcp.oc / simd_w; bofm++) {
+        parallel_nd(jcp.oc / simd_w, [&](int bofm) {
 #pragma omp simd
-                for (int v = 0; v < simd_w; v++)
-                    diff_bias(bofm, v) = 0.0f;
-            }
-        }
-
-        const int ithread = omp_get_thread_num();
-#pragma omp for nowait collapse(3)
-        for (int img = 0; img < jcp.mb; img++) {
-            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ++ifm1) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ++ifm2) {
-                    float *transb = jcp.ver == ver_4fma
-                                  ? &(trans_buffer(ithread, 0))
-                                  : NULL;
-                    diff_src_transform_bwd_weights_ver(img, jcp,
-                            &(diff_src(img, ifm1 * jcp.ic_block + ifm2,
-                                    0, 0, 0)),
-                            &(V(ifm1, 0, 0, 0, ifm2, 0, 0, 0)),
-                            transb,
-                            kernel_->transpose_4fma_ker);
-                }
-            }
-        }
-
-#pragma omp for nowait collapse(3)
-        for (int img = 0; img < jcp.mb; img++) {
-            for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                    float *dbias = jcp.with_bias
-                           ? &(diff_bias_prv(ithread,
-                                       simd_w * (ofm1 * jcp.oc_block + ofm2)))
-                           : NULL;
-                    diff_dst_transform_bwd_weights_ver(img, jcp,
-                            &(diff_dst(img, ofm1 * jcp.oc_block + ofm2,
-                                    0, 0, 0)),
-                            &(M(ofm1, 0, 0, 0, ofm2, 0, 0, 0)),
-                            dbias);
-                }
-            }
-        }
-
-#pragma omp barrier
-
-        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-#pragma omp for nowait collapse(3) schedule(static)
-            for (int oj = 0; oj < jcp.alpha; oj++) {
-                for (int oi = 0; oi < jcp.alpha; oi++) {
-                    for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-                        kernel_->gemm_loop_ker_first_iter(
-                                (float *)&(U(ifm1, ofm1,
-                                        oj, oi,
-                                        0, 0, 0, 0)),
-                                (const float *)&(M(ofm1, oj, oi,
-                                        0, 0, 0, 0, 0)),
-                                (const float *)&(V(ifm1, oj, oi,
-                                        0, 0, 0, 0, 0)));
-                        for (int tile_block = 1; tile_block < jcp.tile_block;
-                                tile_block++) {
-                            kernel_->gemm_loop_ker((float *)&(U(ifm1, ofm1,
-                                            oj, oi,
-                                            0, 0, 0, 0)),
-                                    (const float *)&(M(ofm1, oj, oi, tile_block,
-                                            0, 0, 0, 0)),
-                                    (const float *)&(V(ifm1, oj, oi, tile_block,
-                                            0, 0, 0, 0)));
-                        }
-                    }
-                }
-            }
-        }
-
-#pragma omp barrier
+            for (int v = 0; v < simd_w; v++)
+                diff_bias(bofm, v) = 0.0f;
+        });
+    }
 
-#pragma omp for nowait collapse(4)
-        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-            for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                    for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                        diff_weights_transform_bwd_weights(jcp,
-                                &(diff_weights(ofm1 * jcp.oc_block + ofm2,
-                                        ifm1 * jcp.ic_block + ifm2,
-                                        0, 0, 0, 0)),
-                                &(U(ifm1, ofm1, 0, 0, ofm2, ifm2, 0, 0)));
-                    }
-                }
-            }
-        }
+    parallel(nthreads, [&](const int ithread, const int nthr) {
+        for_nd(ithread, nthr, jcp.mb, jcp.nb_ic, jcp.ic_block,
+                [&](int img, int ifm1, int ifm2) {
+            float *transb = jcp.ver == ver_4fma
+                          ? &(trans_buffer(ithread, 0))
+                          : NULL;
+            diff_src_transform_bwd_weights_ver(img, jcp,
+                    &(diff_src(img, ifm1 * jcp.ic_block + ifm2,
+                            0, 0, 0)),
+                    &(V(ifm1, 0, 0, 0, ifm2, 0, 0, 0)),
+                    transb,
+                    kernel_->transpose_4fma_ker);
+        });
+
+        for_nd(ithread, nthr, jcp.mb, jcp.nb_oc, jcp.oc_block,
+                [&](int img, int ofm1, int ofm2) {
+            float *dbias = jcp.with_bias
+                   ? &(diff_bias_prv(ithread,
+                               simd_w * (ofm1 * jcp.oc_block + ofm2)))
+                   : NULL;
+            diff_dst_transform_bwd_weights_ver(img, jcp,
+                    &(diff_dst(img, ofm1 * jcp.oc_block + ofm2,
+                            0, 0, 0)),
+                    &(M(ofm1, 0, 0, 0, ofm2, 0, 0, 0)),
+                    dbias);
+        });
+    });
+
+    parallel_nd(jcp.nb_ic, jcp.alpha, jcp.alpha, jcp.nb_oc,
+            [&](int ifm1, int oj, int oi, int ofm1) {
+        kernel_->gemm_loop_ker_first_iter(
+                (float *)&(U(ifm1, ofm1,
+                        oj, oi,
+                        0, 0, 0, 0)),
+                (const float *)&(M(ofm1, oj, oi,
+                        0, 0, 0, 0, 0)),
+                (const float *)&(V(ifm1, oj, oi,
+                        0, 0, 0, 0, 0)));
+        for (int tile_block = 1; tile_block < jcp.tile_block;
+                tile_block++) {
+            kernel_->gemm_loop_ker((float *)&(U(ifm1, ofm1,
+                            oj, oi,
+                            0, 0, 0, 0)),
+                    (const float *)&(M(ofm1, oj, oi, tile_block,
+                            0, 0, 0, 0)),
+                    (const float *)&(V(ifm1, oj, oi, tile_block,
+                            0, 0, 0, 0)));
+        }
+    });
+
+    parallel_nd(jcp.nb_ic, jcp.nb_oc, jcp.oc_block, jcp.ic_block,
+            [&](int ifm1, int ofm1, int ofm2, int ifm2) {
+        diff_weights_transform_bwd_weights(jcp,
+                &(diff_weights(ofm1 * jcp.oc_block + ofm2,
+                        ifm1 * jcp.ic_block + ifm2,
+                        0, 0, 0, 0)),
+                &(U(ifm1, ofm1, 0, 0, ofm2, ifm2, 0, 0)));
+    });
 
-        if (jcp.with_bias) {
-#pragma omp for
-            for (int ofm1 = 0; ofm1 < jcp.oc / simd_w; ofm1++) {
-                for (int ithr = 0; ithr < nthreads; ithr++) {
-                    float* base_bias_ptr = &(diff_bias(ofm1, 0));
-                    float* base_bias_prv_ptr = &(diff_bias_prv(
-                                ithr * jcp.oc + ofm1 * simd_w));
+    if (jcp.with_bias) {
+        parallel_nd(jcp.oc / simd_w, [&](int ofm1) {
+            for (int ithr = 0; ithr < nthreads; ithr++) {
+                float* base_bias_ptr = &(diff_bias(ofm1, 0));
+                float* base_bias_prv_ptr = &(diff_bias_prv(
+                            ithr * jcp.oc + ofm1 * simd_w));
 #pragma omp simd
-                    for (int ofm2 = 0; ofm2 < simd_w; ofm2++) {
-                        base_bias_ptr[ofm2] += base_bias_prv_ptr[ofm2];
-                    }
+                for (int ofm2 = 0; ofm2 < simd_w; ofm2++) {
+                    base_bias_ptr[ofm2] += base_bias_prv_ptr[ofm2];
                 }
             }
-        }
-    } // end omp parallel
+        });
+    }
 }
 
 namespace {
@@ -2169,10 +2067,7 @@ void array_sum(int num_arrs, float *output,
     const size_t blocks_number = nelems / block_size;
     const size_t tail = nelems % block_size;
 
-#pragma omp parallel
-    {
-        const int ithr = omp_get_thread_num();
-        const int nthr = omp_get_num_threads();
+    parallel(0, [&](const int ithr, const int nthr) {
         size_t start{ 0 }, end{ 0 };
         balance211(blocks_number, nthr, ithr, start, end);
 
@@ -2209,7 +2104,7 @@ void array_sum(int num_arrs, float *output,
                 }
             }
         }
-    }
+    });
 }
 
 void subarray_sum(int num_arrs, float *output, size_t nelems,
@@ -2220,10 +2115,7 @@ void subarray_sum(int num_arrs, float *output, size_t nelems,
     const size_t blocks_number = nelems / block_size;
     const size_t tail = nelems % block_size;
 
-#pragma omp parallel
-    {
-        const int ithr = omp_get_thread_num();
-        const int nthr = omp_get_num_threads();
+    parallel(0, [&](const int ithr, const int nthr) {
         size_t start{ 0 }, end{ 0 };
         balance211(blocks_number, nthr, ithr, start, end);
 
@@ -2280,7 +2172,7 @@ void subarray_sum(int num_arrs, float *output, size_t nelems,
                 }
             }
         }
-    }
+    });
 }
 } // namespace
 
@@ -2344,105 +2236,79 @@ _execute_backward_weights_S_D_Giot_W()
     array_offset_calculator<float, 2> diff_bias_prv(
             (float *)(scratchpad_->bias_ptr()), nthreads, jcp.oc);
 
-#pragma omp parallel
-    {
-        if (jcp.with_bias) {
-#pragma omp for nowait collapse(2)
-            for (int ithr = 0; ithr < nthreads; ithr++) {
-                for (int ofm = 0; ofm < jcp.oc; ofm++) {
-                    diff_bias_prv(ithr, ofm) = 0.0f;
-                }
-            }
-#pragma omp for nowait
-            for (int bofm = 0; bofm < jcp.oc / simd_w; bofm++) {
-#pragma omp simd
-                for (int v = 0; v < simd_w; v++)
-                    diff_bias(bofm, v) = 0.0f;
-            }
-        }
-    }
-
-#pragma omp parallel
-    {
-        const int ithread = omp_get_thread_num();
-#pragma omp for nowait collapse(3)
-        for (int img = 0; img < jcp.mb; img++) {
-            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ++ifm1) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ++ifm2) {
-                    float *transb = jcp.ver == ver_4fma
-                        ? &(trans_buffer(ithread, 0))
-                        : NULL;
-                    diff_src_transform_bwd_weights_ver(img, jcp,
-                        &(diff_src(img, ifm1 * jcp.ic_block + ifm2,
-                            0, 0, 0)),
-                        &(V(ifm1, 0, 0, 0, ifm2, 0, 0, 0)),
-                        transb,
-                        kernel_->transpose_4fma_ker);
-                }
-            }
-        }
+    if (jcp.with_bias) {
+        parallel_nd(nthreads, jcp.oc, [&](int ithr, int ofm) {
+            diff_bias_prv(ithr, ofm) = 0.0f;
+        });
+        parallel_nd(jcp.oc / simd_w, [&](int bofm) {
+#pragma omp simd
+            for (int v = 0; v < simd_w; v++)
+                diff_bias(bofm, v) = 0.0f;
+        });
     }
 
-#pragma omp parallel num_threads(nthreads)
-#pragma omp for nowait collapse(3)
-    for (int img = 0; img < jcp.mb; img++) {
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                const int ithread = omp_get_thread_num();
-                float *dbias = jcp.with_bias
-                    ? &(diff_bias_prv(ithread,
-                                simd_w * (ofm1 * jcp.oc_block + ofm2)))
-                    : NULL;
-                diff_dst_transform_bwd_weights_ver(img, jcp,
-                        &(diff_dst(img, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
-                        &(M(ofm1, 0, 0, 0, ofm2, 0, 0, 0)), dbias);
-            }
-        }
-    }
+    parallel(nthreads, [&](const int ithread, const int nthr) {
+        for_nd(ithread, nthr, jcp.mb, jcp.nb_ic, jcp.ic_block,
+                [&](int img, int ifm1, int ifm2) {
+            float *transb = jcp.ver == ver_4fma
+                ? &(trans_buffer(ithread, 0))
+                : NULL;
+            diff_src_transform_bwd_weights_ver(img, jcp,
+                &(diff_src(img, ifm1 * jcp.ic_block + ifm2,
+                    0, 0, 0)),
+                &(V(ifm1, 0, 0, 0, ifm2, 0, 0, 0)),
+                transb,
+                kernel_->transpose_4fma_ker);
+        });
+    });
+
+    parallel(nthreads, [&](const int ithread, const int nthr) {
+        for_nd(ithread, nthr, jcp.mb, jcp.nb_oc, jcp.oc_block,
+                [&](int img, int ofm1, int ofm2) {
+            float *dbias = jcp.with_bias
+                ? &(diff_bias_prv(ithread,
+                            simd_w * (ofm1 * jcp.oc_block + ofm2)))
+                : NULL;
+            diff_dst_transform_bwd_weights_ver(img, jcp,
+                    &(diff_dst(img, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
+                    &(M(ofm1, 0, 0, 0, ofm2, 0, 0, 0)), dbias);
+        });
+    });
 
     size_t input_starts[max_threads_number];
     size_t input_ends[max_threads_number];
-    int th_counter = 0;
-#pragma omp parallel firstprivate(th_counter) \
-    num_threads(nthreads)
-#pragma omp for nowait collapse(5) schedule(static)
-    for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int oj = 0; oj < jcp.alpha; oj++) {
-                for (int oi = 0; oi < jcp.alpha; oi++) {
-                    for (int tile_block = 0; tile_block < jcp.tile_block;
-                            tile_block++) {
-                        int ithr = omp_get_thread_num();
-                        if (th_counter == 0) {
-                            input_starts[ithr] = (float *)&(Us(ithr, ifm1, ofm1,
-                                oj, oi, 0, 0, 0, 0)) - (float *)&(Us(ithr, 0, 0,
-                                    0, 0, 0, 0, 0, 0));
-                            input_ends[ithr] = input_starts[ithr]
-                                    + jcp.oc_block * jcp.ic_block
-                                      * jcp.ic_simd_block * jcp.oc_simd_block;
-                        }
-                        else if (tile_block == 0) {
-                            input_ends[ithr] += jcp.oc_block * jcp.ic_block
-                                * jcp.ic_simd_block * jcp.oc_simd_block;
-                        }
-
-                        if (th_counter == 0 || tile_block == 0) {
-                            kernel_->gemm_loop_ker_first_iter(
-                                    &(Us(ithr, ifm1, ofm1, oj, oi, 0, 0, 0, 0)),
-                                    &(M(ofm1, oj, oi, tile_block, 0, 0, 0, 0)),
-                                    &(V(ifm1, oj, oi, tile_block, 0, 0, 0, 0)));
-                        } else {
-                            kernel_->gemm_loop_ker(
-                                    &(Us(ithr, ifm1, ofm1, oj, oi, 0, 0, 0, 0)),
-                                    &(M(ofm1, oj, oi, tile_block, 0, 0, 0, 0)),
-                                    &(V(ifm1, oj, oi, tile_block, 0, 0, 0, 0)));
-                        }
-                        th_counter++;
-                    }
-                }
+    parallel(nthreads, [&](const int ithr, const int nthr) {
+        int th_counter = 0;
+        for_nd(ithr, nthr, jcp.nb_ic, jcp.nb_oc, jcp.alpha, jcp.alpha,
+                jcp.tile_block,
+                [&](int ifm1, int ofm1, int oj, int oi, int tile_block) {
+            if (th_counter == 0) {
+                input_starts[ithr] = (float *)&(Us(ithr, ifm1, ofm1,
+                    oj, oi, 0, 0, 0, 0)) - (float *)&(Us(ithr, 0, 0,
+                        0, 0, 0, 0, 0, 0));
+                input_ends[ithr] = input_starts[ithr]
+                        + jcp.oc_block * jcp.ic_block
+                          * jcp.ic_simd_block * jcp.oc_simd_block;
+            }
+            else if (tile_block == 0) {
+                input_ends[ithr] += jcp.oc_block * jcp.ic_block
+                    * jcp.ic_simd_block * jcp.oc_simd_block;
+            }
+
+            if (th_counter == 0 || tile_block == 0) {
+                kernel_->gemm_loop_ker_first_iter(
+                        &(Us(ithr, ifm1, ofm1, oj, oi, 0, 0, 0, 0)),
+                        &(M(ofm1, oj, oi, tile_block, 0, 0, 0, 0)),
+                        &(V(ifm1, oj, oi, tile_block, 0, 0, 0, 0)));
+            } else {
+                kernel_->gemm_loop_ker(
+                        &(Us(ithr, ifm1, ofm1, oj, oi, 0, 0, 0, 0)),
+                        &(M(ofm1, oj, oi, tile_block, 0, 0, 0, 0)),
+                        &(V(ifm1, oj, oi, tile_block, 0, 0, 0, 0)));
             }
-        }
-    }
+            th_counter++;
+        });
+    });
 
     // Reduce diff-weights
     {
@@ -2455,26 +2321,17 @@ _execute_backward_weights_S_D_Giot_W()
                 nthreads, output, nelems, input_ptrs, input_starts, input_ends);
     }
 
-#pragma omp parallel
-#pragma omp for collapse(4)
-    for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                    diff_weights_transform_bwd_weights(jcp,
-                            &(diff_weights(ofm1 * jcp.oc_block + ofm2,
-                                    ifm1 * jcp.ic_block + ifm2,
-                                    0, 0, 0, 0)),
-                            &(U(ifm1, ofm1, 0, 0, ofm2, ifm2, 0, 0)));
-                }
-            }
-        }
-    }
+    parallel_nd(jcp.nb_ic, jcp.nb_oc, jcp.oc_block, jcp.ic_block,
+            [&](int ifm1, int ofm1, int ofm2, int ifm2) {
+        diff_weights_transform_bwd_weights(jcp,
+                &(diff_weights(ofm1 * jcp.oc_block + ofm2,
+                        ifm1 * jcp.ic_block + ifm2,
+                        0, 0, 0, 0)),
+                &(U(ifm1, ofm1, 0, 0, ofm2, ifm2, 0, 0)));
+    });
 
-#pragma omp parallel
     if (jcp.with_bias) {
-#pragma omp for
-        for (int ofm1 = 0; ofm1 < jcp.oc / simd_w; ofm1++) {
+        parallel_nd(jcp.oc / simd_w, [&](int ofm1) {
             for (int ithr = 0; ithr < nthreads; ithr++) {
                 float* base_bias_ptr = &(diff_bias(ofm1, 0));
                 float* base_bias_prv_ptr = &(diff_bias_prv(
@@ -2484,7 +2341,7 @@ _execute_backward_weights_S_D_Giot_W()
                     base_bias_ptr[ofm2] += base_bias_prv_ptr[ofm2];
                 }
             }
-        }
+        });
     }
 }
 
@@ -2533,67 +2390,60 @@ _execute_backward_weights_SDGtWo()
             nthreads, jcp.oc / jcp.nb_oc);
 
     for (int ofm1 = 0; ofm1 < jcp.nb_oc; ++ofm1) {
-        int th_counter = 0;
-
-#pragma omp parallel
-        {
-            if (jcp.with_bias) {
-#pragma omp for nowait collapse(2)
-                for (int ithr = 0; ithr < nthreads; ithr++) {
-                    for (int ofm = 0; ofm < jcp.oc / jcp.nb_oc; ofm++) {
-                        diff_bias_prv(ithr, ofm) = 0.0f;
-                    }
-                }
-#pragma omp for nowait
-                for (int bofm = 0; bofm < jcp.oc_block; bofm++) {
+        if (jcp.with_bias) {
+            parallel_nd(nthreads, jcp.oc / jcp.nb_oc,
+                    [&](int ithr, int ofm) {
+                diff_bias_prv(ithr, ofm) = 0.0f;
+            });
+            parallel_nd(jcp.oc_block, [&](int bofm) {
 #pragma omp simd
-                    for (int v = 0; v < simd_w; v++)
-                        diff_bias(ofm1, bofm, v) = 0.0f;
+                for (int v = 0; v < simd_w; v++)
+                    diff_bias(ofm1, bofm, v) = 0.0f;
+            });
+        }
+
+        parallel(nthreads, [&](const int ithr, const int nthr) {
+            int th_counter = 0;
+            for_nd(ithr, nthr, jcp.tile_block, [&](int tile_block) {
+                for (int ifm1 = 0; ifm1 < jcp.nb_ic; ++ifm1) {
+                    for (int ifm2 = 0; ifm2 < jcp.ic_block; ++ifm2) {
+                        diff_src_transform_bwd_weights_ver_tile(tile_block, jcp,
+                                &(diff_src(0, ifm1 * jcp.ic_block + ifm2,
+                                        0, 0, 0)),
+                                &(V(ithr, ifm1, 0, 0, ifm2, 0, 0, 0)),
+                                kernel_->transpose_4fma_ker);
+                    }
                 }
-            }
-        }
 
-#pragma omp parallel firstprivate(th_counter) num_threads(nthreads)
-#pragma omp for nowait
-        for (int tile_block = 0; tile_block < jcp.tile_block; tile_block++) {
-            int ithr = omp_get_thread_num();
-            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ++ifm1) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ++ifm2) {
-                    diff_src_transform_bwd_weights_ver_tile(tile_block, jcp,
-                            &(diff_src(0, ifm1 * jcp.ic_block + ifm2, 0, 0, 0)),
-                            &(V(ithr, ifm1, 0, 0, ifm2, 0, 0, 0)),
-                            kernel_->transpose_4fma_ker);
+                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
+                    float *dbias = jcp.with_bias
+                        ? &(diff_bias_prv(ithr, simd_w * ofm2))
+                        : NULL;
+                    diff_dst_transform_bwd_weights_ver(tile_block, jcp,
+                            &(diff_dst(0, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
+                            &(M(ithr, 0, 0, ofm2, 0, 0, 0)),
+                            dbias);
                 }
-            }
 
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                float *dbias = jcp.with_bias
-                    ? &(diff_bias_prv(ithr, simd_w * ofm2))
-                    : NULL;
-                diff_dst_transform_bwd_weights_ver(tile_block, jcp,
-                        &(diff_dst(0, ofm1 * jcp.oc_block + ofm2, 0, 0, 0)),
-                        &(M(ithr, 0, 0, ofm2, 0, 0, 0)),
-                        dbias);
-            }
-
-            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-                for (int oj = 0; oj < jcp.alpha; oj++) {
-                    for (int oi = 0; oi < jcp.alpha; oi++) {
-                        if (th_counter == 0)
-                            kernel_->gemm_loop_ker_first_iter(
-                                    &(Us(ithr, ifm1, oj, oi, 0, 0, 0, 0)),
-                                    &(M(ithr, oj, oi, 0, 0, 0, 0)),
-                                    &(V(ithr, ifm1, oj, oi, 0, 0, 0, 0)));
-                        else
-                            kernel_->gemm_loop_ker(
-                                    &(Us(ithr, ifm1, oj, oi, 0, 0, 0, 0)),
-                                    &(M(ithr, oj, oi, 0, 0, 0, 0)),
-                                    &(V(ithr, ifm1, oj, oi, 0, 0, 0, 0)));
+                for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
+                    for (int oj = 0; oj < jcp.alpha; oj++) {
+                        for (int oi = 0; oi < jcp.alpha; oi++) {
+                            if (th_counter == 0)
+                                kernel_->gemm_loop_ker_first_iter(
+                                        &(Us(ithr, ifm1, oj, oi, 0, 0, 0, 0)),
+                                        &(M(ithr, oj, oi, 0, 0, 0, 0)),
+                                        &(V(ithr, ifm1, oj, oi, 0, 0, 0, 0)));
+                            else
+                                kernel_->gemm_loop_ker(
+                                        &(Us(ithr, ifm1, oj, oi, 0, 0, 0, 0)),
+                                        &(M(ithr, oj, oi, 0, 0, 0, 0)),
+                                        &(V(ithr, ifm1, oj, oi, 0, 0, 0, 0)));
+                        }
                     }
                 }
-            }
-            th_counter++;
-        }
+                th_counter++;
+            });
+        });
         // Reduce diff-weights
         {
             float *output = (float *)(scratchpad_->U_ptr());
@@ -2606,24 +2456,17 @@ _execute_backward_weights_SDGtWo()
             array_sum(nthreads, output, nelems, input_ptrs);
         }
 
-#pragma omp parallel
-#pragma omp for collapse(3)
-        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                    diff_weights_transform_bwd_weights(jcp,
-                            &(diff_weights(ofm1 * jcp.oc_block + ofm2,
-                                    ifm1 * jcp.ic_block + ifm2,
-                                    0, 0, 0, 0)),
-                            &(Us(0, ifm1, 0, 0, ofm2, ifm2, 0, 0)));
-                }
-            }
-        }
+        parallel_nd(jcp.nb_ic, jcp.oc_block, jcp.ic_block,
+                [&](int ifm1, int ofm2, int ifm2) {
+            diff_weights_transform_bwd_weights(jcp,
+                    &(diff_weights(ofm1 * jcp.oc_block + ofm2,
+                            ifm1 * jcp.ic_block + ifm2,
+                            0, 0, 0, 0)),
+                    &(Us(0, ifm1, 0, 0, ofm2, ifm2, 0, 0)));
+        });
 
-#pragma omp parallel
         if (jcp.with_bias) {
-#pragma omp for
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
+            parallel_nd(jcp.oc_block, [&](int ofm2) {
                 for (int ithr = 0; ithr < nthreads; ithr++) {
                     float* base_bias_ptr = &(diff_bias(ofm1, ofm2, 0));
                     float* base_bias_prv_ptr = &(diff_bias_prv(
@@ -2633,7 +2476,7 @@ _execute_backward_weights_SDGtWo()
                         base_bias_ptr[ofm3] += base_bias_prv_ptr[ofm3];
                     }
                 }
-            }
+            });
         }
     }
 }
@@ -2687,74 +2530,67 @@ _execute_backward_weights_SDGt_W()
             (float *)(scratchpad_->bias_ptr()),
             nthreads, jcp.oc);
 
-#pragma omp parallel
-    {
-        if (jcp.with_bias) {
-#pragma omp for nowait collapse(2)
-            for (int ithr = 0; ithr < nthreads; ithr++) {
-                for (int ofm = 0; ofm < jcp.oc; ofm++) {
-                    diff_bias_prv(ithr, ofm) = 0.0f;
-                }
-            }
-#pragma omp for nowait
-            for (int bofm = 0; bofm < jcp.oc / simd_w; bofm++) {
-#pragma omp simd
-                for (int v = 0; v < simd_w; v++)
-                    diff_bias(bofm, v) = 0.0f;
-            }
-        }
+    if (jcp.with_bias) {
+        parallel_nd(nthreads, jcp.oc, [&](int ithr, int ofm) {
+            diff_bias_prv(ithr, ofm) = 0.0f;
+        });
+        parallel_nd(jcp.oc / simd_w, [&](int bofm) {
+#pragma omp simd
+            for (int v = 0; v < simd_w; v++)
+                diff_bias(bofm, v) = 0.0f;
+        });
     }
 
-    int th_counter = 0;
-#pragma omp parallel firstprivate(th_counter) num_threads(nthreads)
-#pragma omp for nowait
-    for (int tile_block = 0; tile_block < jcp.tile_block; tile_block++) {
-        int ithr = omp_get_thread_num();
-
-        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ++ifm1) {
-            for (int ifm2 = 0; ifm2 < jcp.ic_block; ++ifm2) {
-                diff_src_transform_bwd_weights_ver_tile(tile_block, jcp,
-                        &(diff_src(0, ifm1 * jcp.ic_block + ifm2,
-                                0, 0, 0)),
-                        &(V(ithr, ifm1, 0, 0, ifm2, 0, 0, 0)),
-                        kernel_->transpose_4fma_ker);
+    parallel(nthreads, [&](const int ithr, const int nthr) {
+        int th_counter = 0;
+        for_nd(ithr, nthr, jcp.tile_block, [&](int tile_block) {
+            for (int ifm1 = 0; ifm1 < jcp.nb_ic; ++ifm1) {
+                for (int ifm2 = 0; ifm2 < jcp.ic_block; ++ifm2) {
+                    diff_src_transform_bwd_weights_ver_tile(tile_block, jcp,
+                            &(diff_src(0, ifm1 * jcp.ic_block + ifm2,
+                                    0, 0, 0)),
+                            &(V(ithr, ifm1, 0, 0, ifm2, 0, 0, 0)),
+                            kernel_->transpose_4fma_ker);
+                }
             }
-        }
 
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                float *dbias = jcp.with_bias
-                    ? &(diff_bias_prv(ithr,
-                                simd_w * (ofm1 * jcp.oc_block + ofm2)))
-                    : NULL;
-                diff_dst_transform_bwd_weights_ver(tile_block, jcp,
-                        &(diff_dst(0, ofm1 * jcp.oc_block + ofm2,
-                                0, 0, 0)),
-                        &(M(ithr, ofm1, 0, 0, ofm2, 0, 0, 0)),
-                        dbias);
+            for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
+                for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
+                    float *dbias = jcp.with_bias
+                        ? &(diff_bias_prv(ithr,
+                                    simd_w * (ofm1 * jcp.oc_block + ofm2)))
+                        : NULL;
+                    diff_dst_transform_bwd_weights_ver(tile_block, jcp,
+                            &(diff_dst(0, ofm1 * jcp.oc_block + ofm2,
+                                    0, 0, 0)),
+                            &(M(ithr, ofm1, 0, 0, ofm2, 0, 0, 0)),
+                            dbias);
+                }
             }
-        }
 
-        for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-            for (int oj = 0; oj < jcp.alpha; oj++) {
-                for (int oi = 0; oi < jcp.alpha; oi++) {
-                    for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-                        if (th_counter == 0)
-                            kernel_->gemm_loop_ker_first_iter(
-                                    &(Us(ithr, ofm1, ifm1, oj, oi, 0, 0, 0, 0)),
-                                    &(M(ithr, ofm1, oj, oi, 0, 0, 0, 0)),
-                                    &(V(ithr, ifm1, oj, oi, 0, 0, 0, 0)));
-                        else
-                            kernel_->gemm_loop_ker(
-                                    &(Us(ithr, ofm1, ifm1, oj, oi, 0, 0, 0, 0)),
-                                    &(M(ithr, ofm1, oj, oi, 0, 0, 0, 0)),
-                                    &(V(ithr, ifm1, oj, oi, 0, 0, 0, 0)));
+            for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
+                for (int oj = 0; oj < jcp.alpha; oj++) {
+                    for (int oi = 0; oi < jcp.alpha; oi++) {
+                        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
+                            if (th_counter == 0)
+                                kernel_->gemm_loop_ker_first_iter(
+                                        &(Us(ithr, ofm1, ifm1, oj, oi,
+                                                0, 0, 0, 0)),
+                                        &(M(ithr, ofm1, oj, oi, 0, 0, 0, 0)),
+                                        &(V(ithr, ifm1, oj, oi, 0, 0, 0, 0)));
+                            else
+                                kernel_->gemm_loop_ker(
+                                        &(Us(ithr, ofm1, ifm1, oj, oi,
+                                                0, 0, 0, 0)),
+                                        &(M(ithr, ofm1, oj, oi, 0, 0, 0, 0)),
+                                        &(V(ithr, ifm1, oj, oi, 0, 0, 0, 0)));
+                        }
                     }
                 }
             }
-        }
-        th_counter++;
-    }
+            th_counter++;
+        });
+    });
 
     // Reduce diff-weights
     {
@@ -2767,26 +2603,17 @@ _execute_backward_weights_SDGt_W()
         array_sum(nthreads, output, nelems, input_ptrs);
     }
 
-#pragma omp parallel
-#pragma omp for collapse(4)
-    for (int ofm1 = 0; ofm1 < jcp.nb_oc; ofm1++) {
-        for (int ifm1 = 0; ifm1 < jcp.nb_ic; ifm1++) {
-            for (int ofm2 = 0; ofm2 < jcp.oc_block; ofm2++) {
-                for (int ifm2 = 0; ifm2 < jcp.ic_block; ifm2++) {
-                    diff_weights_transform_bwd_weights(jcp,
-                            &(diff_weights(ofm1 * jcp.oc_block + ofm2,
-                                    ifm1 * jcp.ic_block + ifm2,
-                                    0, 0, 0, 0)),
-                            &(U(ofm1, ifm1, 0, 0, ofm2, ifm2, 0, 0)));
-                }
-            }
-        }
-    }
+    parallel_nd(jcp.nb_oc, jcp.nb_ic, jcp.oc_block, jcp.ic_block,
+            [&](int ofm1, int ifm1, int ofm2, int ifm2) {
+        diff_weights_transform_bwd_weights(jcp,
+                &(diff_weights(ofm1 * jcp.oc_block + ofm2,
+                        ifm1 * jcp.ic_block + ifm2,
+                        0, 0, 0, 0)),
+                &(U(ofm1, ifm1, 0, 0, ofm2, ifm2, 0, 0)));
+    });
 
-#pragma omp parallel
     if (jcp.with_bias) {
-#pragma omp for
-        for (int ofm1 = 0; ofm1 < jcp.oc / simd_w; ofm1++) {
+        parallel_nd(jcp.oc / simd_w, [&](int ofm1) {
             for (int ithr = 0; ithr < nthreads; ithr++) {
                 float* base_bias_ptr = &(diff_bias(ofm1, 0));
                 float* base_bias_prv_ptr = &(diff_bias_prv(
@@ -2796,7 +2623,7 @@ _execute_backward_weights_SDGt_W()
                     base_bias_ptr[ofm2] += base_bias_prv_ptr[ofm2];
                 }
             }
-        }
+        });
     }
 }
 }
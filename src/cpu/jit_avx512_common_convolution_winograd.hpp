@@ -32,10 +32,12 @@ namespace winograd {
 
 struct winograd_scratchpad_t {
     public:
-        winograd_scratchpad_t(const jit_conv_winograd_conf_t &jcp)
+        winograd_scratchpad_t(const jit_conv_winograd_conf_t &jcp,
+                scratchpad_mode_t mode = scratchpad_mode::library)
+            : scratchpad_(nullptr), user_scratchpad_(nullptr)
         {
             get_scratchpad_size_(jcp);
-            allocate_scratchpad_(jcp);
+            allocate_scratchpad_(jcp, mode);
         }
 
         ~winograd_scratchpad_t() {
@@ -43,29 +45,48 @@ struct winograd_scratchpad_t {
                 delete scratchpad_;
         }
 
+        /* the size of the scratchpad user has to provide in the user
+         * scratchpad mode */
+        static size_t size(const jit_conv_winograd_conf_t &jcp) {
+            winograd_scratchpad_t s(jcp, scratchpad_mode::user);
+            return s.scratchpad_sz_;
+        }
+
+        /* the buffers are written with aligned (non-temporal) stores, hence
+         * the scratchpad has to be aligned on the vector size */
+        status_t set_user_scratchpad(void *scratchpad) {
+            const size_t alignment = 64;
+            bool ok = scratchpad_ == nullptr && scratchpad != nullptr
+                && (size_t)scratchpad % alignment == 0;
+            if (!ok)
+                return status::invalid_arguments;
+            user_scratchpad_ = (char *)scratchpad;
+            return status::success;
+        }
+
         char *U_ptr() {
             /* buffer for wei transform U*/
-            return scratchpad_->get() + U_offset_;
+            return get_() + U_offset_;
         }
 
         char *V_ptr() {
             /* buffer for src transform V*/
-            return scratchpad_->get() + V_offset_;
+            return get_() + V_offset_;
         }
 
         char *M_ptr() {
             /* buffer for dst transform M*/
-            return scratchpad_->get() + M_offset_;
+            return get_() + M_offset_;
         }
 
         char *bias_ptr() {
             /* buffer for bias update in bwdw*/
-            return scratchpad_->get() + bias_offset_;
+            return get_() + bias_offset_;
         }
 
         char *src_transpose_ptr() {
             /* buffer for src transpose in bwdw using qfma*/
-            return scratchpad_->get() + src_transpose_offset_;
+            return get_() + src_transpose_offset_;
         }
 
         int num_threads(){
@@ -73,8 +94,18 @@ struct winograd_scratchpad_t {
         }
 
     private:
+        inline char *get_() const {
+            if (scratchpad_ != nullptr)
+                return scratchpad_->get();
+            assert(user_scratchpad_ != nullptr
+                    && "the user scratchpad is not set");
+            return user_scratchpad_;
+        }
+
         inline void get_scratchpad_size_(const jit_conv_winograd_conf_t &jcp) {
-            nthreads_ = omp_get_max_threads();
+            /* the thread count is fixed at the pd creation, so that the size
+             * does not depend on when it is queried */
+            nthreads_ = jcp.nthr;
 
             U_sz_ = jcp.alpha * jcp.alpha * jcp.ic * jcp.oc * sizeof(float);
             V_sz_ = jcp.alpha * jcp.alpha * jcp.mb * jcp.ic
@@ -143,7 +174,8 @@ struct winograd_scratchpad_t {
             }
         }
 
-        inline void allocate_scratchpad_(const jit_conv_winograd_conf_t &jcp) {
+        inline void allocate_scratchpad_(const jit_conv_winograd_conf_t &jcp,
+                scratchpad_mode_t mode) {
             const size_t page_size = 2097152;
             U_offset_ = 0;
             V_offset_ = utils::rnd_up(U_sz_, page_size);
@@ -161,10 +193,12 @@ struct winograd_scratchpad_t {
                              : M_offset_ + utils::rnd_up(M_sz_, page_size);
                 scratchpad_sz_ = bias_offset_ + bias_sz_;
             }
-            scratchpad_ = create_scratchpad(scratchpad_sz_);
+            if (mode == scratchpad_mode::library)
+                scratchpad_ = create_scratchpad(scratchpad_sz_);
         }
 
         scratchpad_t *scratchpad_;
+        char *user_scratchpad_;
         int nthreads_;
         size_t scratchpad_sz_ = 0, U_sz_ = 0, V_sz_ = 0, M_sz_ = 0,
                bias_sz_ = 0, src_transpose_sz_ = 0;
@@ -174,6 +208,11 @@ struct winograd_scratchpad_t {
         size_t bias_offset_ = 0;
         size_t src_transpose_offset_ = 0; // only relevant for bwdw using qfma
 };
+
+/* the element-wise products of the transformed tiles; the transforms are
+ * accounted as the memory traffic through the scratchpad */
+inline double winograd_flops(const jit_conv_winograd_conf_t &jcp)
+{ return 2. * jcp.ntiles * jcp.alpha * jcp.alpha * jcp.ic * jcp.oc; }
 }
 
 template <bool with_relu>
@@ -184,11 +223,17 @@ struct _jit_avx512_common_convolution_winograd_fwd_t : public cpu_primitive_t {
                 const typename pd_t::base_class *hint_fwd_pd)
             : _cpu_convolution_fwd_pd_t<with_relu>(engine, adesc, attr,
                     hint_fwd_pd)
-            , jcp_({}) {}
+            , jcp_({}), scratchpad_size_(0) {}
 
         DECLARE_COMMON_PD_T(
                 _jit_avx512_common_convolution_winograd_fwd_t<with_relu>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.6,
+                    winograd::winograd_flops(this->jcp_),
+                    io_bytes(this) + 2. * this->scratchpad_size_);
+        }
+
         virtual status_t init() override
         {
             using namespace prop_kind;
@@ -206,13 +251,21 @@ struct _jit_avx512_common_convolution_winograd_fwd_t : public cpu_primitive_t {
             if (!ok)
                 return status::unimplemented;
 
-            return jit_avx512_common_conv_winograd_fwd_kernel_f32::init_conf(
+            status_t status
+                = jit_avx512_common_conv_winograd_fwd_kernel_f32::init_conf(
                     jcp_, this->cdesc_(), *this->src_pd_.desc(),
                     *this->weights_pd_.desc(), *this->dst_pd_.desc(), with_relu,
                     this->negative_slope());
+            if (status == status::success)
+                scratchpad_size_ = winograd::winograd_scratchpad_t::size(jcp_);
+            return status;
         }
 
+        virtual size_t scratchpad_size() const override
+        { return scratchpad_size_; }
+
         jit_conv_winograd_conf_t jcp_;
+        size_t scratchpad_size_;
 
     protected:
         virtual status_t set_default_params() override
@@ -240,7 +293,8 @@ struct _jit_avx512_common_convolution_winograd_fwd_t : public cpu_primitive_t {
     {
         const auto &jcp = conf_.jcp_;
         kernel_ = new jit_avx512_common_conv_winograd_fwd_kernel_f32(jcp);
-        scratchpad_ = new winograd::winograd_scratchpad_t(jcp);
+        scratchpad_ = new winograd::winograd_scratchpad_t(jcp,
+                conf_.attr()->scratchpad_mode_);
     }
 
     ~_jit_avx512_common_convolution_winograd_fwd_t()
@@ -249,6 +303,9 @@ struct _jit_avx512_common_convolution_winograd_fwd_t : public cpu_primitive_t {
         delete scratchpad_;
     };
 
+    virtual status_t set_scratchpad(void *scratchpad) override
+    { return scratchpad_->set_user_scratchpad(scratchpad); }
+
     typedef typename prec_traits<data_type::f32>::type data_t;
 
     virtual void execute(event_t *e)
@@ -292,10 +349,16 @@ struct jit_avx512_common_convolution_winograd_bwd_data_t
                 const primitive_attr_t *attr,
                 const convolution_fwd_pd_t *hint_fwd_pd)
             : cpu_convolution_bwd_data_pd_t(engine, adesc, attr, hint_fwd_pd)
-            , jcp_({}) {}
+            , jcp_({}), scratchpad_size_(0) {}
 
         DECLARE_COMMON_PD_T(jit_avx512_common_convolution_winograd_bwd_data_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.6,
+                    winograd::winograd_flops(this->jcp_),
+                    io_bytes(this) + 2. * this->scratchpad_size_);
+        }
+
         virtual status_t init() override
         {
             using namespace prop_kind;
@@ -310,13 +373,21 @@ struct jit_avx512_common_convolution_winograd_bwd_data_t
             if (!ok)
                 return status::unimplemented;
 
-            return jit_avx512_common_conv_winograd_bwd_data_kernel_f32::
+            status_t status
+                = jit_avx512_common_conv_winograd_bwd_data_kernel_f32::
                     init_conf(jcp_, *this->desc(), *this->diff_src_pd_.desc(),
                             *this->weights_pd_.desc(),
                             *this->diff_dst_pd_.desc());
+            if (status == status::success)
+                scratchpad_size_ = winograd::winograd_scratchpad_t::size(jcp_);
+            return status;
         }
 
+        virtual size_t scratchpad_size() const override
+        { return scratchpad_size_; }
+
         jit_conv_winograd_conf_t jcp_;
+        size_t scratchpad_size_;
 
     protected:
         virtual status_t set_default_params() override
@@ -343,7 +414,8 @@ struct jit_avx512_common_convolution_winograd_bwd_data_t
     {
         const auto &jcp = conf_.jcp_;
         kernel_ = new jit_avx512_common_conv_winograd_bwd_data_kernel_f32(jcp);
-        scratchpad_ = new winograd::winograd_scratchpad_t(jcp);
+        scratchpad_ = new winograd::winograd_scratchpad_t(jcp,
+                conf_.attr()->scratchpad_mode_);
     }
 
     ~jit_avx512_common_convolution_winograd_bwd_data_t()
@@ -352,6 +424,9 @@ struct jit_avx512_common_convolution_winograd_bwd_data_t
         delete scratchpad_;
     };
 
+    virtual status_t set_scratchpad(void *scratchpad) override
+    { return scratchpad_->set_user_scratchpad(scratchpad); }
+
     typedef typename prec_traits<data_type::f32>::type data_t;
 
     virtual void execute(event_t *e)
@@ -395,10 +470,16 @@ struct jit_avx512_common_convolution_winograd_bwd_weights_t
                 const convolution_fwd_pd_t *hint_fwd_pd)
             : cpu_convolution_bwd_weights_pd_t(engine, adesc, attr,
                     hint_fwd_pd)
-            , jcp_({}) {}
+            , jcp_({}), scratchpad_size_(0) {}
 
         DECLARE_COMMON_PD_T(jit_avx512_common_convolution_winograd_bwd_weights_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<avx512_common>::vlen, 0.5,
+                    winograd::winograd_flops(this->jcp_),
+                    io_bytes(this) + 2. * this->scratchpad_size_);
+        }
+
         virtual status_t init() override
         {
             using namespace prop_kind;
@@ -413,13 +494,29 @@ struct jit_avx512_common_convolution_winograd_bwd_weights_t
             if (!ok)
                 return status::unimplemented;
 
-            return jit_avx512_common_conv_winograd_bwd_weights_kernel_f32::
+            status_t status
+                = jit_avx512_common_conv_winograd_bwd_weights_kernel_f32::
                     init_conf(jcp_, *this->desc(), *this->src_pd_.desc(),
                             *this->diff_dst_pd_.desc(),
                             *this->diff_weights_pd_.desc());
+            if (status == status::success)
+                scratchpad_size_ = winograd::winograd_scratchpad_t::size(jcp_);
+            return status;
+        }
+
+        virtual size_t scratchpad_size() const override
+        { return scratchpad_size_; }
+
+        virtual size_t memory_consumption() const override {
+            /* the 4fma source transform allocates a tile buffer per thread */
+            const size_t tile_size = jcp_.ver == ver_4fma
+                ? jcp_.alpha * jcp_.alpha * jcp_.tile_4fma * 16 : 0;
+            return scratchpad_size_
+                + mkldnn_get_max_threads() * tile_size * sizeof(float);
         }
 
         jit_conv_winograd_conf_t jcp_;
+        size_t scratchpad_size_;
 
     protected:
         virtual status_t set_default_params() override
@@ -449,7 +546,8 @@ struct jit_avx512_common_convolution_winograd_bwd_weights_t
         auto jcp = conf_.jcp_;
         kernel_ = new jit_avx512_common_conv_winograd_bwd_weights_kernel_f32(
                 jcp);
-        scratchpad_ = new winograd::winograd_scratchpad_t(jcp);
+        scratchpad_ = new winograd::winograd_scratchpad_t(jcp,
+                conf_.attr()->scratchpad_mode_);
     }
 
     ~jit_avx512_common_convolution_winograd_bwd_weights_t()
@@ -458,6 +556,9 @@ struct jit_avx512_common_convolution_winograd_bwd_weights_t
         delete scratchpad_;
     };
 
+    virtual status_t set_scratchpad(void *scratchpad) override
+    { return scratchpad_->set_user_scratchpad(scratchpad); }
+
     typedef typename prec_traits<data_type::f32>::type data_t;
 
     virtual void execute(event_t *e)
@@ -17,6 +17,7 @@
 #include <math.h>
 
 #include "mkldnn_thread.hpp"
+#include "nstl.hpp"
 #include "utils.hpp"
 
 #include "jit_avx512_common_gemm_f32.hpp"
@@ -2034,13 +2035,29 @@ inline void jit_avx512_common_gemm_f32::calc_nthr_nocopy_avx512_common(int m,
 #undef BN_SMALL_NOCOPY_AVX512_COMMON
 #undef BK_SMALL_NOCOPY_AVX512_COMMON
 
+size_t jit_avx512_common_gemm_f32::memory_consumption()
+{
+    return sizeof(unsigned int *) * mkldnn_get_max_threads() * CACHE_LINE_SIZE;
+}
+
+size_t jit_avx512_common_gemm_f32::sgemm_memory_consumption(int m, int n, int k,
+        int nthr)
+{
+    int MB, NB, KB;
+    int nthr_m, nthr_n, nthr_k;
+    calc_nthr_nocopy_avx512_common(
+            m, n, k, nthr, &nthr_m, &nthr_n, &nthr_k, &MB, &NB, &KB);
+    if (nthr_k == 1) return 0;
+    return (size_t)nthr_m * nthr_n * (nthr_k - 1) * MB * NB * sizeof(float);
+}
+
 void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
         const int *p_m, const int *p_n, const int *p_k, const float *p_alpha,
         const float *A, const int *p_lda, const float *B, const int *p_ldb,
         const float *p_beta, float *C, const int *p_ldc, const float *bias)
 {
     assert(*transa == transa_ && *transb == transb_ && *p_beta == beta_);
-    int nthr = (omp_in_parallel()) ? 1 : omp_get_max_threads();
+    int nthr = (mkldnn_in_parallel()) ? 1 : mkldnn_get_max_threads();
     int m = *p_m;
     int n = *p_n;
     int k = *p_k;
@@ -2052,7 +2069,7 @@ void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
 
     int nthr_m, nthr_n, nthr_k, nthr_mn;
 
-    assert(nthr <= nthrs_);
+    assert(utils::implication(MKLDNN_THR_SYNC == 1, nthr <= nthrs_));
 
     // Determine threading partitioning
     calc_nthr_nocopy_avx512_common(
@@ -2070,15 +2087,15 @@ void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
     float *c_buffers = NULL;
 
     if (nthr_k > 1) {
-        for (int i = 0; i < nthr; i++)
-            ompstatus[i * CACHE_LINE_SIZE] = 0;
+        if (MKLDNN_THR_SYNC == 1)
+            for (int i = 0; i < nthr; i++)
+                ompstatus[i * CACHE_LINE_SIZE] = 0;
 
         c_buffers = (float *)Xbyak::AlignedMalloc(
                 nthr_m * nthr_n * (nthr_k - 1) * MB * NB * sizeof(float), 4096);
     }
 
-#pragma omp parallel for num_threads(nthr)
-    for (int ithr_omp = 0; ithr_omp < nthr; ithr_omp++) {
+    parallel(nthr, [&](const int ithr_omp, const int) {
         int ithr_omp_m, ithr_omp_n, ithr_omp_k, ithr_omp_mn;
         int m_from, m_to, myM;
         int n_from, n_to, myN;
@@ -2150,11 +2167,11 @@ void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
                 sgemm_nocopy_driver(transa, transb, myM, myN, myK, p_alpha, myA,
                         lda, myB, ldb, &myBeta, myC, ld, myBias);
 
-                if (nthr_k > 1)
+                if (nthr_k > 1 && MKLDNN_THR_SYNC == 1)
                     ompstatus[(ibase + ithr_omp_k) * CACHE_LINE_SIZE] = 1;
             }
 
-            if (nthr_k > 1) {
+            if (nthr_k > 1 && MKLDNN_THR_SYNC == 1) {
 
                 // sum matrices partitioned along K dimension
                 int n1, n2;
@@ -2189,6 +2206,37 @@ void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
                 }
             }
         }
+    });
+
+    /* the threads cannot wait for each other (see MKLDNN_THR_SYNC), hence
+     * the matrices partitioned along K dimension are summed in another pass */
+    if (nthr_k > 1 && MKLDNN_THR_SYNC == 0) {
+        parallel(nthr, [&](const int ithr_omp, const int) {
+            if (ithr_omp >= nthr_m * nthr_n * nthr_k) return;
+
+            const int ithr_omp_mn = ithr_omp % nthr_mn;
+            const int ithr_omp_m = ithr_omp_mn % nthr_m;
+            const int ithr_omp_n = ithr_omp_mn / nthr_m;
+            const int ithr_omp_k = ithr_omp / nthr_mn;
+
+            const int m_from = MB * ithr_omp_m;
+            const int myM = nstl::min(m, MB * (ithr_omp_m + 1)) - m_from;
+            const int n_from = NB * ithr_omp_n;
+            const int myN = nstl::min(n, NB * (ithr_omp_n + 1)) - n_from;
+            if (myM <= 0 || myN <= 0) return;
+
+            const int cbase = (ithr_omp_m + nthr_m * ithr_omp_n) * (nthr_k - 1);
+
+            int n1, n2;
+            partition_unit_diff(ithr_omp_k, nthr_k, myN, &n1, &n2);
+
+            for (int ik = 1; ik < nthr_k; ++ik) {
+                float *myC = c_buffers + MB * NB * (cbase + ik - 1)
+                    + n1 * MB;
+                sum_two_matrices(myM, n2, myC, MB,
+                        &C[m_from + (n_from + n1) * ldc], ldc);
+            }
+        });
     }
 
     if (nthr_k > 1)
@@ -2217,7 +2265,7 @@ jit_avx512_common_gemm_f32::jit_avx512_common_gemm_f32(
         ker_b0_ = ker_bn_;
     }
 
-    nthrs_ = omp_get_max_threads();
+    nthrs_ = mkldnn_get_max_threads();
     ompstatus_ = (unsigned int *)malloc(
         sizeof(unsigned int *) * nthrs_ * CACHE_LINE_SIZE, 64);
     assert(ompstatus_);
@@ -35,6 +35,13 @@ public:
             char transa, char transb, float beta, bool hasBias = false);
     ~jit_avx512_common_gemm_f32();
 
+    /** returns the memory a gemm object allocates (bytes) */
+    static size_t memory_consumption();
+    /** returns the memory sgemm() allocates for the given sizes (bytes),
+     * @p nthr is the number of threads it runs on (1 inside a parallel
+     * region) */
+    static size_t sgemm_memory_consumption(int m, int n, int k, int nthr);
+
 private:
     typedef void (*ker)(long long int, long long int, long long int, float *,
             float *, long long int, float *, long long int, float *, float *,
@@ -47,7 +54,7 @@ private:
             int ithr, int nthr, int n, int *t_offset, int *t_block);
     inline void sum_two_matrices(
             int m, int n, float *p_src, int ld_src, float *p_dst, int ld_dst);
-    inline void calc_nthr_nocopy_avx512_common(int m, int n, int k, int nthrs,
+    static inline void calc_nthr_nocopy_avx512_common(int m, int n, int k, int nthrs,
             int *nthrs_m, int *nthrs_n, int *nthrs_k, int *BM, int *BN,
             int *BK);
 
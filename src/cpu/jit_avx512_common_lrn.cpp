@@ -452,10 +452,7 @@ void jit_avx512_common_lrn_fwd_t::execute_forward() {
         }
     };
 
-# pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 struct jit_avx512_common_lrn_bwd_t::jit_avx512_common_lrn_kernel_f32:
@@ -860,10 +857,7 @@ void jit_avx512_common_lrn_bwd_t::execute_backward() {
         }
     };
 
-# pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 }
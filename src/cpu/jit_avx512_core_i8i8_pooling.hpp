@@ -38,6 +38,12 @@ struct jit_avx512_core_i8i8_pooling_fwd_t : public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_avx512_core_i8i8_pooling_fwd_t);
 
+        /* the int8 data makes 4 elements per 32-bit lane */
+        virtual double time_estimate() const override {
+            return estimate_time(4 * cpu_isa_traits<avx512_core>::vlen, 0.5,
+                    pool_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             assert(this->engine()->kind() == engine_kind::cpu);
             bool ok = true
@@ -790,7 +790,7 @@ _jit_avx512_core_u8s8s32x_convolution_fwd_t(const pd_t *pd,
     ker_ = new jit_avx512_core_u8s8s32x_conv_fwd_ker_t(conf_.jcp_,
             *conf_.attr());
 
-    const int nthreads = omp_get_max_threads();
+    const int nthreads = mkldnn_get_max_threads();
     ws_per_thread_ = conf_.jcp_.ow * conf_.jcp_.oc_block;
     ws_ = (acc_data_t *)malloc(
             nthreads * ws_per_thread_ * sizeof(acc_data_t), 64);
@@ -869,10 +869,7 @@ execute_forward() {
         }
     };
 
-#   pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 template struct _jit_avx512_core_u8s8s32x_convolution_fwd_t<true, data_type::s8>;
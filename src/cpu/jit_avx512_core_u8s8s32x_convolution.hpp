@@ -43,6 +43,12 @@ struct _jit_avx512_core_u8s8s32x_convolution_fwd_t : public cpu_primitive_t {
         DECLARE_COMMON_PD_T( _jit_avx512_core_u8s8s32x_convolution_fwd_t<
                 with_relu, dst_data_type>);
 
+        /* a 32-bit lane does 4 int8 multiply-adds */
+        virtual double time_estimate() const override {
+            return estimate_time(4 * cpu_isa_traits<avx512_core>::vlen, 0.7,
+                    conv_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -48,6 +48,16 @@ typedef enum {
     avx512_mic_4ops,
 } cpu_isa_t;
 
+/** returns true if the jit implementations are allowed to use @p isa. The
+ * limit is taken from the MKLDNN_MAX_CPU_ISA environment variable and can be
+ * changed with set_max_cpu_isa() (mkldnn_set_max_cpu_isa()) */
+bool cpu_isa_allowed(cpu_isa_t isa);
+
+/** limits the jit implementations to @p max_isa and the ISAs it extends
+ * (e.g. avx512_mic allows avx512_common, but not avx512_core); isa_any
+ * removes the limit */
+void set_max_cpu_isa(cpu_isa_t max_isa);
+
 template <cpu_isa_t> struct cpu_isa_traits {}; /* ::vlen -> 32 (for avx2) */
 
 template <> struct cpu_isa_traits<sse42> {
@@ -133,6 +143,8 @@ static Xbyak::util::Cpu cpu;
 static inline bool mayiuse(const cpu_isa_t cpu_isa) {
     using namespace Xbyak::util;
 
+    if (!cpu_isa_allowed(cpu_isa)) return false;
+
     switch (cpu_isa) {
     case sse42:
         return cpu.has(Cpu::tSSE42);
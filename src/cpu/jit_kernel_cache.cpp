@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+#include <mutex>
+#include <unordered_map>
+
+#include "mkldnn.h"
+
+#include "cpu_engine.hpp"
+#include "jit_kernel_cache.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+namespace jit_kernel_cache {
+
+namespace {
+struct entry_t {
+    const void *tag;
+    int isa;
+    char *conf;
+    size_t conf_size;
+    jit_generator *kernel;
+    int ref_count;
+};
+
+/* FNV-1a */
+size_t hash_conf(const void *conf, size_t conf_size) {
+    const unsigned char *p = (const unsigned char *)conf;
+    size_t hash = (size_t)14695981039346656037ull;
+    for (size_t i = 0; i < conf_size; ++i) {
+        hash ^= p[i];
+        hash *= (size_t)1099511628211ull;
+    }
+    return hash;
+}
+
+/* the entries are indexed both by the hash of their configuration (for
+ * acquire) and by their kernel (for release) */
+struct cache_t {
+    std::mutex mutex;
+    std::unordered_multimap<size_t, entry_t *> by_conf;
+    std::unordered_map<const jit_generator *, entry_t *> by_kernel;
+    int ref_count;
+
+    cache_t(): ref_count(0) {}
+
+    entry_t *find(const void *tag, int isa, const void *conf,
+            size_t conf_size, size_t hash) {
+        auto range = by_conf.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            entry_t *e = it->second;
+            bool match = true
+                && e->tag == tag
+                && e->isa == isa
+                && e->conf_size == conf_size
+                && memcmp(e->conf, conf, conf_size) == 0;
+            if (match) return e;
+        }
+        return nullptr;
+    }
+};
+
+/* the cache lives as long as the library, hence it is allocated once and
+ * never destroyed to avoid static destruction order issues with primitives
+ * destroyed at exit */
+cache_t &cache() {
+    static cache_t *c = new cache_t;
+    return *c;
+}
+}
+
+jit_generator *acquire(const void *tag, const void *conf, size_t conf_size) {
+    const int isa = get_cpu_isa_tag();
+    const size_t hash = hash_conf(conf, conf_size);
+
+    cache_t &c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    entry_t *e = c.find(tag, isa, conf, conf_size, hash);
+    if (e == nullptr) return nullptr;
+    ++e->ref_count;
+    ++c.ref_count;
+    return e->kernel;
+}
+
+jit_generator *insert(const void *tag, const void *conf, size_t conf_size,
+        jit_generator *kernel) {
+    const int isa = get_cpu_isa_tag();
+    const size_t hash = hash_conf(conf, conf_size);
+
+    entry_t *new_e = new entry_t;
+    char *conf_copy = (char *)impl::malloc(conf_size, 64);
+    if (utils::any_null(new_e, conf_copy)) {
+        /* just do not share it */
+        delete new_e;
+        impl::free(conf_copy);
+        return kernel;
+    }
+    memcpy(conf_copy, conf, conf_size);
+
+    cache_t &c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    ++c.ref_count;
+    entry_t *e = c.find(tag, isa, conf, conf_size, hash);
+    if (e != nullptr) {
+        delete new_e;
+        impl::free(conf_copy);
+        delete kernel;
+        ++e->ref_count;
+        return e->kernel;
+    }
+
+    *new_e = { tag, isa, conf_copy, conf_size, kernel, 1 };
+    c.by_conf.insert(std::make_pair(hash, new_e));
+    c.by_kernel[kernel] = new_e;
+    return kernel;
+}
+
+void release(const jit_generator *kernel) {
+    cache_t &c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    auto k = c.by_kernel.find(kernel);
+    if (k == c.by_kernel.end()) {
+        /* the kernel was not registered (e.g. out of memory in insert) */
+        delete kernel;
+        return;
+    }
+
+    entry_t *e = k->second;
+    --c.ref_count;
+    if (--e->ref_count > 0) return;
+
+    auto range = c.by_conf.equal_range(hash_conf(e->conf, e->conf_size));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == e) {
+            c.by_conf.erase(it);
+            break;
+        }
+    }
+    c.by_kernel.erase(k);
+
+    delete e->kernel;
+    impl::free(e->conf);
+    delete e;
+}
+
+size_t size() {
+    cache_t &c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    return c.by_kernel.size();
+}
+
+int ref_count() {
+    cache_t &c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    return c.ref_count;
+}
+
+}
+
+}
+}
+}
+
+mkldnn_status_t mkldnn_get_jit_kernel_cache_stats(int *n_kernels,
+        int *n_references) {
+    using namespace mkldnn::impl::cpu;
+    if (n_kernels) *n_kernels = (int)jit_kernel_cache::size();
+    if (n_references) *n_references = jit_kernel_cache::ref_count();
+    return mkldnn::impl::status::success;
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_KERNEL_CACHE_HPP
+#define CPU_JIT_KERNEL_CACHE_HPP
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+#include "jit_generator.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/** \brief A process-wide cache of generated jit kernels
+ *
+ * Kernels whose code is fully defined by their configuration structure
+ * (jit_conv_conf_t, jit_1x1_conv_conf_t, jit_pool_conf_t, ...) are shared
+ * between all primitives with bytewise equal configurations, so that a network
+ * with many layers of the same shape holds (and generates) a single copy of
+ * the machine code. The kernels are reference counted and destroyed when the
+ * last primitive using them is destroyed.
+ *
+ * @warning
+ *   Only kernels that do not keep any per-primitive state and whose code
+ *   does not depend on anything but the configuration (and the ISA) may be
+ *   shared. In particular, the kernel must not use the attributes it might
+ *   have been created with after the code is generated.
+ *
+ * @note
+ *   The configuration should be zero-initialized by init_conf() so that
+ *   unused fields and padding do not prevent the sharing.
+ */
+namespace jit_kernel_cache {
+
+/** returns the kernel registered for (@p tag, @p conf) with incremented
+ * reference counter or @c nullptr */
+jit_generator *acquire(const void *tag, const void *conf, size_t conf_size);
+
+/** registers @p kernel for (@p tag, @p conf) and returns it. If another
+ * thread has registered a kernel for the same key meanwhile, @p kernel is
+ * destroyed and the registered one is returned instead */
+jit_generator *insert(const void *tag, const void *conf, size_t conf_size,
+        jit_generator *kernel);
+
+/** decrements the reference counter of @p kernel, destroying the kernel when
+ * it reaches zero */
+void release(const jit_generator *kernel);
+
+/** returns the number of distinct kernels held by the cache */
+size_t size();
+
+/** returns the total number of references to the kernels held by the cache */
+int ref_count();
+
+template <typename kernel_t> struct tag_t { static const char id; };
+template <typename kernel_t> const char tag_t<kernel_t>::id = 0;
+
+}
+
+template <typename kernel_t, typename conf_t, typename... Args>
+kernel_t *get_shared_kernel(const conf_t &conf, Args &&... args) {
+    const void *tag = &jit_kernel_cache::tag_t<kernel_t>::id;
+    jit_generator *k = jit_kernel_cache::acquire(tag, &conf, sizeof(conf));
+    if (k == nullptr)
+        k = jit_kernel_cache::insert(tag, &conf, sizeof(conf),
+                new kernel_t(conf, utils::forward<Args>(args)...));
+    return static_cast<kernel_t *>(k);
+}
+
+inline void release_shared_kernel(const jit_generator *kernel) {
+    if (kernel) jit_kernel_cache::release(kernel);
+}
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
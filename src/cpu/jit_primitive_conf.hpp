@@ -163,6 +163,7 @@ struct jit_conv_winograd_conf_t : public jit_conv_conf_t {
     int dimN_nb_block;
 
     winograd_sched_t sched_policy;
+    int nthr; /* the number of threads the scratchpad is sized for */
 };
 
 struct jit_conv_call_s {
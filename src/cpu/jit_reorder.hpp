@@ -23,6 +23,7 @@
 #include "type_helpers.hpp"
 #include "cpu_reorder_pd.hpp"
 #include "cpu_primitive.hpp"
+#include "mkldnn_thread.hpp"
 
 #include "simple_reorder.hpp"
 
@@ -207,16 +208,12 @@ struct jit_reorder_t : public cpu_primitive_t {
 
         const int _G = w_grps ? dims[0] : 1;
 
-#       pragma omp parallel for collapse(3) schedule(static)
-        for (int g = 0; g < _G; ++g) {
-            for (int o = 0; o < dims[w_grps + 0] / blksize; ++o) {
-                for (int i = 0; i < dims[w_grps + 1] / blksize; ++i) {
-                    auto i_ptr = &input[input_d.blk_off<!w_grps>(g, o, i)];
-                    auto o_ptr = &output[output_d.blk_off<!w_grps>(g, o, i)];
-                    (*kernel_)(i_ptr, o_ptr);
-                }
-            }
-        }
+        parallel_nd(_G, dims[w_grps + 0] / blksize,
+                dims[w_grps + 1] / blksize, [&](int g, int o, int i) {
+            auto i_ptr = &input[input_d.blk_off<!w_grps>(g, o, i)];
+            auto o_ptr = &output[output_d.blk_off<!w_grps>(g, o, i)];
+            (*kernel_)(i_ptr, o_ptr);
+        });
     }
 
     virtual void execute(event_t *e) {
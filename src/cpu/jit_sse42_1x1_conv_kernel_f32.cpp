@@ -499,6 +499,8 @@ status_t jit_sse42_1x1_conv_kernel_f32::init_conf(jit_1x1_conv_conf_t &jcp,
     if (!mayiuse(sse42))
         return status::unimplemented;
 
+    jcp = zero<decltype(jcp)>();
+
     // TODO (Roma): this code is duplicated from the generic kernel; maybe the
     // configuration struct could do some stuff below
     const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
@@ -120,10 +120,7 @@ void _jit_sse42_1x1_convolution_fwd_t<with_relu>::execute_forward() {
         }
     };
 
-#   pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 template void _jit_sse42_1x1_convolution_fwd_t<true>::execute_forward();
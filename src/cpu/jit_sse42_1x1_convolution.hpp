@@ -22,6 +22,7 @@
 #include "cpu_engine.hpp"
 #include "cpu_reducer.hpp"
 #include "jit_sse42_1x1_conv_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 #include "mkldnn_thread.hpp"
 #include "utils.hpp"
 
@@ -44,6 +45,11 @@ struct _jit_sse42_1x1_convolution_fwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(_jit_sse42_1x1_convolution_fwd_t<with_relu>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<sse42>::vlen, 0.65,
+                    conv_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             assert(this->engine()->kind() == engine_kind::cpu);
@@ -90,8 +96,11 @@ struct _jit_sse42_1x1_convolution_fwd_t: public cpu_primitive_t {
     _jit_sse42_1x1_convolution_fwd_t(const pd_t *pd,
             const input_vector &inputs, const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
-    { kernel_ = new jit_sse42_1x1_conv_kernel_f32(conf_.jcp_, *conf_.attr()); }
-    ~_jit_sse42_1x1_convolution_fwd_t() { delete kernel_; };
+    {
+        kernel_ = get_shared_kernel<jit_sse42_1x1_conv_kernel_f32>(conf_.jcp_,
+                *conf_.attr());
+    }
+    ~_jit_sse42_1x1_convolution_fwd_t() { release_shared_kernel(kernel_); };
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
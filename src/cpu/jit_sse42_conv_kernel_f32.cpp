@@ -414,6 +414,8 @@ status_t jit_sse42_conv_fwd_kernel_f32::init_conf(jit_conv_conf_t &jcp,
 {
     if (!mayiuse(sse42)) return status::unimplemented;
 
+    jcp = zero<decltype(jcp)>();
+
     jcp.prop_kind = cd.prop_kind;
 
     const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
@@ -235,29 +235,38 @@ struct rtus_driver_t: public jit_generator {
     }
 };
 
-template <cpu_isa_t isa, typename conv_t>
-inline void init_rtus_driver(conv_t *self) {
-    const auto &conf = self->conf_;
-    const auto &cd = *conf.cdesc();
-    const bool is_bwd_data = cd.prop_kind == prop_kind::backward_data;
-
-    if (!conf.rtus_.reduce_src_) return;
+/* the size of the per thread buffer the source is reduced to unit strides
+ * into (elements), 0 if the reduction is not needed */
+template <typename conv_pd_t>
+inline size_t rtus_ws_per_thread(const conv_pd_t *conf) {
+    if (!conf->rtus_.reduce_src_) return 0;
 
-    const int max_threads = omp_get_max_threads();
     size_t factor = 0;
-    switch (cd.prop_kind) {
+    switch (conf->cdesc()->prop_kind) {
     case prop_kind::forward_training: case prop_kind::forward_inference:
-        factor = conf.jcp_.nb_reduce; break;
+        factor = conf->jcp_.nb_reduce; break;
     case prop_kind::backward_data:
-        factor = conf.jcp_.nb_load_blocking_max; break;
+        factor = conf->jcp_.nb_load_blocking_max; break;
     case prop_kind::backward_weights:
-        factor = conf.jcp_.nb_bcast_blocking; break;
+        factor = conf->jcp_.nb_bcast_blocking; break;
     default: assert(!"unsupported prop_kind");
     }
 
+    return factor * conf->jcp_.is * conf->jcp_.ic_block;
+}
+
+template <cpu_isa_t isa, typename conv_t>
+inline void init_rtus_driver(conv_t *self) {
+    const auto &conf = self->conf_;
+    const auto &cd = *conf.cdesc();
+    const bool is_bwd_data = cd.prop_kind == prop_kind::backward_data;
+
+    if (!conf.rtus_.reduce_src_) return;
+
+    const int max_threads = mkldnn_get_max_threads();
     size_t typesize = sizeof(decltype(*self->scratch_));
 
-    self->ws_per_thread_ = factor * conf.jcp_.is * conf.jcp_.ic_block;
+    self->ws_per_thread_ = rtus_ws_per_thread(&conf);
     self->scratch_ = (decltype(self->scratch_))malloc(
             max_threads * self->ws_per_thread_ * typesize, 64);
 
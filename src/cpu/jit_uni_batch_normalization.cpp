@@ -757,7 +757,8 @@ struct jit_bnorm_t: public jit_generator {
 template <cpu_isa_t isa>
 struct uni_bnorm_driver_t: public c_compatible {
     uni_bnorm_driver_t(const batch_normalization_pd_t *bdesc)
-        : bdesc_(bdesc), ker_(bdesc_), syncable_(true), buf_(nullptr)
+        : bdesc_(bdesc), ker_(bdesc_), syncable_(MKLDNN_THR_SYNC == 1)
+        , buf_(nullptr)
         , barriers_(nullptr)
     {
         use_tmp_stats_ = !bdesc_->stats_is_src()
@@ -966,11 +967,10 @@ void jit_uni_batch_normalization_fwd_t<isa>::execute(event_t *e) {
     auto scale_shift =
         reinterpret_cast<const data_t *>(this->input_memory(idx_scale_shift));
 
-#   pragma omp parallel
-    {
-        bnorm_driver_->exec(omp_get_thread_num(), omp_get_num_threads(), src,
-                nullptr, dst, nullptr, scale_shift, nullptr, mean, var);
-    }
+    parallel(0, [&](const int ithr, const int nthr) {
+        bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr,
+                scale_shift, nullptr, mean, var);
+    });
     e->set_state(event_t::ready);
 }
 
@@ -996,12 +996,10 @@ void jit_uni_batch_normalization_bwd_t<isa>::execute(event_t *e) {
     auto diff_src = reinterpret_cast<data_t*>(this->memory(0));
     auto diff_scale_shift = reinterpret_cast<data_t *>(this->memory(1));
 
-#   pragma omp parallel
-    {
-        bnorm_driver_->exec(omp_get_thread_num(), omp_get_num_threads(), src,
-                diff_src, nullptr, diff_dst, scale_shift, diff_scale_shift,
-                mean, var);
-    }
+    parallel(0, [&](const int ithr, const int nthr) {
+        bnorm_driver_->exec(ithr, nthr, src, diff_src, nullptr, diff_dst,
+                scale_shift, diff_scale_shift, mean, var);
+    });
     e->set_state(event_t::ready);
 }
 
@@ -44,6 +44,11 @@ struct jit_uni_batch_normalization_fwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_uni_batch_normalization_fwd_t<isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<isa>::vlen, 0.5,
+                    bnorm_flops(this), bnorm_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace data_type;
@@ -98,6 +103,11 @@ struct jit_uni_batch_normalization_bwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_uni_batch_normalization_bwd_t<isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<isa>::vlen, 0.5,
+                    bnorm_flops(this), bnorm_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace data_type;
@@ -1008,10 +1008,7 @@ void jit_uni_eltwise_fwd_t<isa>::execute_forward() {
             (*kernel_)(&arg);
     };
 
-#   pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 template <cpu_isa_t isa>
@@ -1079,10 +1076,7 @@ void jit_uni_eltwise_bwd_t<isa>::execute_backward() {
             (*kernel_)(&arg);
     };
 
-#   pragma omp parallel
-    {
-        ker(omp_get_thread_num(), omp_get_num_threads());
-    }
+    parallel(0, ker);
 }
 
 template struct jit_uni_eltwise_fwd_t<sse42>;
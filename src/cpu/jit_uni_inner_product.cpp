@@ -105,10 +105,7 @@ void jit_uni_inner_product_bwd_weights_t<isa>::execute_backward_weights()
         constexpr int blksize = 8;
         int OC_blocks = OC / blksize;
         int rem_OC = OC % blksize;
-#       pragma omp parallel
-        {
-            const int ithr = omp_get_thread_num();
-            const int nthr = omp_get_num_threads();
+        parallel(0, [&](const int ithr, const int nthr) {
             int oc_st{0}, oc_e{0};
             balance211(OC_blocks, nthr, ithr, oc_st, oc_e);
             oc_st = oc_st * blksize;
@@ -135,7 +132,7 @@ void jit_uni_inner_product_bwd_weights_t<isa>::execute_backward_weights()
                     }
                 }
             }
-        }
+        });
     }
 }
 
@@ -43,6 +43,17 @@ struct jit_uni_inner_product_fwd_t : public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_uni_inner_product_fwd_t<isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<isa>::vlen, 0.6, ip_flops(this),
+                    io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            return jit_uni_gemm_f32::memory_consumption()
+                + jit_uni_gemm_f32::sgemm_memory_consumption(OC(), MB(), IC_total(),
+                        mkldnn_get_max_threads());
+        }
+
         virtual status_t init() override
         {
             using namespace prop_kind;
@@ -114,6 +125,17 @@ struct jit_uni_inner_product_bwd_weights_t : public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_uni_inner_product_bwd_weights_t<isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<isa>::vlen, 0.6, ip_flops(this),
+                    io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            return jit_uni_gemm_f32::memory_consumption()
+                + jit_uni_gemm_f32::sgemm_memory_consumption(IC_total(), OC(), MB(),
+                        mkldnn_get_max_threads());
+        }
+
         virtual status_t init() override
         {
             using namespace prop_kind;
@@ -182,6 +204,17 @@ struct jit_uni_inner_product_bwd_data_t : public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_uni_inner_product_bwd_data_t<isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<isa>::vlen, 0.6, ip_flops(this),
+                    io_bytes(this));
+        }
+
+        virtual size_t memory_consumption() const override {
+            return jit_uni_gemm_f32::memory_consumption()
+                + jit_uni_gemm_f32::sgemm_memory_consumption(IC_total(), MB(), OC(),
+                        mkldnn_get_max_threads());
+        }
+
         virtual status_t init() override
         {
             using namespace prop_kind;
@@ -41,6 +41,8 @@ status_t jit_uni_pool_kernel_f32<isa>::init_conf(jit_pool_conf_t &jpp,
         && pd.kernel[0] == pd.kernel[1];
     if (!args_ok) return status::unimplemented;
 
+    jpp = utils::zero<decltype(jpp)>();
+
     const int simd_w = isa == avx512_common ? 16 : 8;
 
     jpp.mb = src_d.dims()[0];
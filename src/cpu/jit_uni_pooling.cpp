@@ -20,6 +20,7 @@
 #include "jit_uni_pooling.hpp"
 #include "type_helpers.hpp"
 #include "nstl.hpp"
+#include "mkldnn_thread.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -65,14 +66,9 @@ void jit_uni_pooling_fwd_t<isa>::execute_forward() {
         (*kernel_)(&arg);
     };
 
-#   pragma omp parallel for collapse(3) schedule(static)
-    for (int n = 0; n < jpp.mb; ++n) {
-        for (int b_c = 0; b_c < jpp.nb_c; ++b_c) {
-            for (int oh = 0; oh < jpp.oh; ++oh) {
-                ker (n, b_c, oh);
-            }
-        }
-    }
+    parallel_nd(jpp.mb, jpp.nb_c, jpp.oh, [&](int n, int b_c, int oh) {
+        ker (n, b_c, oh);
+    });
 }
 
 template <cpu_isa_t isa>
@@ -115,14 +111,11 @@ void jit_uni_pooling_bwd_t<isa>::execute_backward() {
         (*kernel_)(&arg);
     };
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int n = 0; n < jpp.mb; ++n) {
-        for (int b_c = 0; b_c < jpp.nb_c; ++b_c) {
-            for (int oh = 0; oh < jpp.oh; ++oh) {
-                ker (n, b_c, oh);
-            }
+    parallel_nd(jpp.mb, jpp.nb_c, [&](int n, int b_c) {
+        for (int oh = 0; oh < jpp.oh; ++oh) {
+            ker (n, b_c, oh);
         }
-    }
+    });
 }
 
 template struct jit_uni_pooling_fwd_t<sse42>;
@@ -23,6 +23,7 @@
 #include "cpu_pooling_pd.hpp"
 #include "cpu_engine.hpp"
 #include "jit_uni_pool_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -40,6 +41,11 @@ struct jit_uni_pooling_fwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_uni_pooling_fwd_t<isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<isa>::vlen, 0.5,
+                    pool_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace alg_kind;
@@ -90,9 +96,9 @@ struct jit_uni_pooling_fwd_t: public cpu_primitive_t {
     jit_uni_pooling_fwd_t(const pd_t *pd, const input_vector &inputs,
             const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
-    { kernel_ = new jit_uni_pool_kernel_f32<isa>(conf_.jpp_); }
+    { kernel_ = get_shared_kernel<jit_uni_pool_kernel_f32<isa>>(conf_.jpp_); }
 
-    ~jit_uni_pooling_fwd_t() { delete kernel_; }
+    ~jit_uni_pooling_fwd_t() { release_shared_kernel(kernel_); }
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
@@ -117,6 +123,11 @@ struct jit_uni_pooling_bwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(jit_uni_pooling_bwd_t<isa>);
 
+        virtual double time_estimate() const override {
+            return estimate_time(cpu_isa_traits<isa>::vlen, 0.5,
+                    pool_flops(this), io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace alg_kind;
@@ -168,9 +179,9 @@ struct jit_uni_pooling_bwd_t: public cpu_primitive_t {
     jit_uni_pooling_bwd_t(const pd_t *pd, const input_vector &inputs,
             const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
-    { kernel_ = new jit_uni_pool_kernel_f32<isa>(conf_.jpp_); }
+    { kernel_ = get_shared_kernel<jit_uni_pool_kernel_f32<isa>>(conf_.jpp_); }
 
-    ~jit_uni_pooling_bwd_t() { delete kernel_; }
+    ~jit_uni_pooling_bwd_t() { release_shared_kernel(kernel_); }
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
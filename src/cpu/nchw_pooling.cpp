@@ -21,6 +21,7 @@
 #include "type_helpers.hpp"
 #include "math_utils.hpp"
 #include "nstl.hpp"
+#include "mkldnn_thread.hpp"
 
 #include "nchw_pooling.hpp"
 
@@ -107,37 +108,23 @@ void nchw_pooling_fwd_t<data_type>::execute_forward() {
 
 
     if (conf_.desc()->alg_kind == pooling_max) {
-#       pragma omp parallel for collapse(4) schedule(static)
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int c = 0; c < C; ++c) {
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        auto dst_offset = mb*C*OH*OW + c*OH*OW + oh*OW + ow;
-                        data_t *d = &dst[dst_offset];
-                        d[0] = nstl::numeric_limits<data_t>::lowest();
-                        if (ws) {
-                            ws[ws_d.off(mb, c, oh, ow)] = 0;
-                        }
-
-                        ker_max(d, mb, c, oh, ow);
-                    }
-                }
+        parallel_nd(MB, C, OH, OW, [&](int mb, int c, int oh, int ow) {
+            auto dst_offset = mb*C*OH*OW + c*OH*OW + oh*OW + ow;
+            data_t *d = &dst[dst_offset];
+            d[0] = nstl::numeric_limits<data_t>::lowest();
+            if (ws) {
+                ws[ws_d.off(mb, c, oh, ow)] = 0;
             }
-        }
+
+            ker_max(d, mb, c, oh, ow);
+        });
     } else {
-#       pragma omp parallel for collapse(4) schedule(static)
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int c = 0; c < C; ++c) {
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        auto dst_offset = mb*C*OH*OW + c*OH*OW + oh*OW + ow;
-                        data_t *d = &dst[dst_offset];
-                        d[0] = 0;
-                        ker_avg(d, mb, c, oh, ow);
-                    }
-                }
-            }
-        }
+        parallel_nd(MB, C, OH, OW, [&](int mb, int c, int oh, int ow) {
+            auto dst_offset = mb*C*OH*OW + c*OH*OW + oh*OW + ow;
+            data_t *d = &dst[dst_offset];
+            d[0] = 0;
+            ker_avg(d, mb, c, oh, ow);
+        });
     }
 }
 
@@ -212,33 +199,27 @@ void nchw_pooling_bwd_t<data_type>::execute_backward() {
     };
 
     if (conf_.desc()->alg_kind == pooling_max) {
-#       pragma omp parallel for collapse(2) schedule(static)
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int c = 0; c < C; ++c) {
-                auto diff_dst_offset = mb*C*OH*OW + c*OH*OW;
-                ker_zero(mb, c);
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        const data_t *d = &diff_dst[diff_dst_offset++];
-                        ker_max(d, mb, c, oh, ow);
-                    }
+        parallel_nd(MB, C, [&](int mb, int c) {
+            auto diff_dst_offset = mb*C*OH*OW + c*OH*OW;
+            ker_zero(mb, c);
+            for (int oh = 0; oh < OH; ++oh) {
+                for (int ow = 0; ow < OW; ++ow) {
+                    const data_t *d = &diff_dst[diff_dst_offset++];
+                    ker_max(d, mb, c, oh, ow);
                 }
             }
-        }
+        });
     } else {
-#       pragma omp parallel for collapse(2) schedule(static)
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int c = 0; c < C; ++c) {
-                auto diff_dst_offset = mb*C*OH*OW + c*OH*OW;
-                ker_zero(mb, c);
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        const data_t *d = &diff_dst[diff_dst_offset++];
-                        ker_avg(d, mb, c, oh, ow);
-                    }
+        parallel_nd(MB, C, [&](int mb, int c) {
+            auto diff_dst_offset = mb*C*OH*OW + c*OH*OW;
+            ker_zero(mb, c);
+            for (int oh = 0; oh < OH; ++oh) {
+                for (int ow = 0; ow < OW; ++ow) {
+                    const data_t *d = &diff_dst[diff_dst_offset++];
+                    ker_avg(d, mb, c, oh, ow);
                 }
             }
-        }
+        });
     }
 }
 
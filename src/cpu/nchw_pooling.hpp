@@ -41,6 +41,11 @@ struct nchw_pooling_fwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(nchw_pooling_fwd_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(sizeof(float), 0.5, pool_flops(this),
+                    io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace alg_kind;
@@ -95,6 +100,11 @@ struct nchw_pooling_bwd_t: public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T(nchw_pooling_bwd_t);
 
+        virtual double time_estimate() const override {
+            return estimate_time(sizeof(float), 0.5, pool_flops(this),
+                    io_bytes(this));
+        }
+
         virtual status_t init() override {
             using namespace prop_kind;
             using namespace alg_kind;
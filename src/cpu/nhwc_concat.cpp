@@ -16,6 +16,8 @@
 
 #include <string.h>
 
+#include "mkldnn_thread.hpp"
+
 #include "nhwc_concat.hpp"
 
 namespace mkldnn {
@@ -42,19 +44,16 @@ void nhwc_concat_t<data_type>::execute() {
     const int h = dst_d.dims()[2];
     const int w = dst_d.dims()[3];
 
-#   pragma omp parallel for schedule(static) collapse(2)
-    for (int iter_n = 0; iter_n < n; ++iter_n) {
-        for (int iter_h = 0; iter_h < h; ++iter_h) {
-            for (int iter_w = 0; iter_w < w; ++iter_w) {
-                for (int iter_srcs = 0; iter_srcs < num_srcs; ++iter_srcs) {
-                    const size_t e = iter_n * h * w + iter_h * w + iter_w;
-                    const data_t *i = &src[iter_srcs][e*ic[iter_srcs]];
-                    data_t *o = &img[iter_srcs][e*oc];
-                    memcpy(o, i, ic[iter_srcs] * sizeof(data_t));
-                }
+    parallel_nd(n, h, [&](int iter_n, int iter_h) {
+        for (int iter_w = 0; iter_w < w; ++iter_w) {
+            for (int iter_srcs = 0; iter_srcs < num_srcs; ++iter_srcs) {
+                const size_t e = iter_n * h * w + iter_h * w + iter_w;
+                const data_t *i = &src[iter_srcs][e*ic[iter_srcs]];
+                data_t *o = &img[iter_srcs][e*oc];
+                memcpy(o, i, ic[iter_srcs] * sizeof(data_t));
             }
         }
-    }
+    });
 }
 
 template struct nhwc_concat_t<data_type::f32>;
@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "type_helpers.hpp"
+#include "mkldnn_thread.hpp"
 
 #include "ref_batch_normalization.hpp"
 
@@ -64,8 +65,7 @@ void ref_batch_normalization_fwd_t<data_type>::execute_forward() {
         return (with_relu && res < 0) ? 0 : res;
     };
 
-#   pragma omp parallel for schedule(static)
-    for (int c = 0; c < C; ++c) {
+    parallel_nd(C, [&](int c) {
         data_t v_mean = calculate_stats ? 0 : mean[c];
         data_t v_variance = calculate_stats ? 0 : variance[c];
 
@@ -104,7 +104,7 @@ void ref_batch_normalization_fwd_t<data_type>::execute_forward() {
                 variance[c] = v_variance;
             }
         }
-    }
+    });
 }
 
 template struct ref_batch_normalization_fwd_t<data_type::f32>;
@@ -136,8 +136,7 @@ void ref_batch_normalization_bwd_t<data_type>::execute_backward() {
     const bool calculate_diff_stats = !conf_.omit_stats();
 
 
-#   pragma omp parallel for schedule(static)
-    for (int c = 0; c < C; ++c) {
+    parallel_nd(C, [&](int c) {
         data_t v_mean = mean[mean_d.off(c)];
         data_t v_variance = variance[variance_d.off(c)];
         data_t sqrt_variance = static_cast<data_t>(1. / sqrt(v_variance + eps));
@@ -173,7 +172,7 @@ void ref_batch_normalization_bwd_t<data_type>::execute_backward() {
             v_diff_src *= gamma*sqrt_variance;
             diff_src[diff_data_d.off(n, c, h, w)] = v_diff_src;
         }
-    }
+    });
 }
 
 template struct ref_batch_normalization_bwd_t<data_type::f32>;
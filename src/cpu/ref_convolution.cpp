@@ -18,6 +18,7 @@
 #include "type_helpers.hpp"
 #include "mkldnn_traits.hpp"
 #include "math_utils.hpp"
+#include "mkldnn_thread.hpp"
 
 #include "ref_convolution.hpp"
 
@@ -99,24 +100,15 @@ void _ref_convolution_fwd_t<with_relu, src_type, wei_type, dst_type, acc_type>
         return 0;
     };
 
-#   pragma omp parallel for collapse(5) schedule(static)
-    for (int g = 0; g < G; ++g) {
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int oc = 0; oc < OC; ++oc) {
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        acc_data_t a = bias
-                            ? get_bias(bias_d.off(g*OC + oc)) : (acc_data_t)0;
-                        ker(a, g, mb, oc, oh, ow);
-                        if (with_relu && a < (acc_data_t)0)
-                            a = (acc_data_t)((float)a * nslope);
-                        dst[dst_d.off(mb, g*OC + oc, oh, ow)]
-                            = saturate<dst_data_t>(a);
-                    }
-                }
-            }
-        }
-    }
+    parallel_nd(G, MB, OC, OH, OW, [&](int g, int mb, int oc, int oh, int ow) {
+        acc_data_t a = bias
+            ? get_bias(bias_d.off(g*OC + oc)) : (acc_data_t)0;
+        ker(a, g, mb, oc, oh, ow);
+        if (with_relu && a < (acc_data_t)0)
+            a = (acc_data_t)((float)a * nslope);
+        dst[dst_d.off(mb, g*OC + oc, oh, ow)]
+            = saturate<dst_data_t>(a);
+    });
 }
 
 template <data_type_t diff_src_type, data_type_t wei_type,
@@ -181,21 +173,12 @@ void ref_convolution_bwd_data_t<diff_src_type, wei_type, diff_dst_type,
         }
     };
 
-#   pragma omp parallel for collapse(5) schedule(static)
-    for (int g = 0; g < G; ++g) {
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int ic = 0; ic < IC; ++ic) {
-                for (int ih = 0; ih < IH; ++ih) {
-                    for (int iw = 0; iw < IW; ++iw) {
-                        auto ds_idx = diff_src_d.off(mb, g*IC + ic, ih, iw);
-                        acc_data_t a = acc_data_t(0);
-                        ker(a, g, mb, ic, ih, iw);
-                        diff_src[ds_idx] = saturate<diff_src_data_t>(a);
-                    }
-                }
-            }
-        }
-    }
+    parallel_nd(G, MB, IC, IH, IW, [&](int g, int mb, int ic, int ih, int iw) {
+        auto ds_idx = diff_src_d.off(mb, g*IC + ic, ih, iw);
+        acc_data_t a = acc_data_t(0);
+        ker(a, g, mb, ic, ih, iw);
+        diff_src[ds_idx] = saturate<diff_src_data_t>(a);
+    });
 }
 
 template <data_type_t src_type, data_type_t diff_wei_type,
@@ -267,31 +250,28 @@ void ref_convolution_bwd_weights_t<src_type, diff_wei_type, diff_dst_type,
         }
     };
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int g = 0; g < G; ++g) {
-        for (int oc = 0; oc < OC; ++oc) {
-            if (diff_bias) {
-                acc_data_t db = 0;
-                ker_bias(db, g, oc);
-                diff_bias[diff_bias_d.off(g*OC+oc)]
-                    = saturate<diff_wei_data_t>(db);
-            }
+    parallel_nd(G, OC, [&](int g, int oc) {
+        if (diff_bias) {
+            acc_data_t db = 0;
+            ker_bias(db, g, oc);
+            diff_bias[diff_bias_d.off(g*OC+oc)]
+                = saturate<diff_wei_data_t>(db);
+        }
 
-            for (int ic = 0; ic < IC; ++ic) {
-                for (int kh = 0; kh < KH; ++kh) {
-                    for (int kw = 0; kw < KW; ++kw) {
-                        acc_data_t dw = 0;
-                        ker(dw, g, oc, ic, kh, kw);
+        for (int ic = 0; ic < IC; ++ic) {
+            for (int kh = 0; kh < KH; ++kh) {
+                for (int kw = 0; kw < KW; ++kw) {
+                    acc_data_t dw = 0;
+                    ker(dw, g, oc, ic, kh, kw);
 
-                        auto idx = with_groups
-                            ? diff_weights_d.off(g, oc, ic, kh, kw)
-                            : diff_weights_d.off(oc, ic, kh, kw);
-                        diff_weights[idx] = saturate<diff_wei_data_t>(dw);
-                    }
+                    auto idx = with_groups
+                        ? diff_weights_d.off(g, oc, ic, kh, kw)
+                        : diff_weights_d.off(oc, ic, kh, kw);
+                    diff_weights[idx] = saturate<diff_wei_data_t>(dw);
                 }
             }
         }
-    }
+    });
 }
 
 using namespace data_type;
@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "type_helpers.hpp"
+#include "mkldnn_thread.hpp"
 
 #include "ref_eltwise.hpp"
 
@@ -146,32 +147,25 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_generic() {
     const float alpha = conf_.desc()->alpha;
     const float beta = conf_.desc()->beta;
 
-#   pragma omp parallel for collapse(4) schedule(static)
-    for (int n = 0; n < MB; ++n) {
-        for (int c = 0; c < C; ++c) {
-            for (int h = 0; h < H; ++h) {
-                for (int w = 0; w < W; ++w) {
-                    auto d_off = data_d.off(n, c, h, w);
-                    data_t s = src[d_off];
-                    data_t &d = dst[d_off];
-                    switch (alg_kind) {
-                    case eltwise_relu: d = relu_fwd(s, alpha); break;
-                    case eltwise_tanh: d = tanh_fwd(s); break;
-                    case eltwise_elu: d = elu_fwd(s, alpha); break;
-                    case eltwise_square: d = square_fwd(s); break;
-                    case eltwise_abs: d = abs_fwd(s); break;
-                    case eltwise_sqrt: d = sqrt_fwd(s); break;
-                    case eltwise_linear: d = linear_fwd(s, alpha, beta); break;
-                    case eltwise_bounded_relu:
-                        d = bounded_relu_fwd(s, alpha); break;
-                    case eltwise_soft_relu: d = soft_relu_fwd(s); break;
-                    case eltwise_logistic: d = logistic_fwd(s); break;
-                    default: assert(!"unknown eltwise alg_kind");
-                    }
-                }
-            }
+    parallel_nd(MB, C, H, W, [&](int n, int c, int h, int w) {
+        auto d_off = data_d.off(n, c, h, w);
+        data_t s = src[d_off];
+        data_t &d = dst[d_off];
+        switch (alg_kind) {
+        case eltwise_relu: d = relu_fwd(s, alpha); break;
+        case eltwise_tanh: d = tanh_fwd(s); break;
+        case eltwise_elu: d = elu_fwd(s, alpha); break;
+        case eltwise_square: d = square_fwd(s); break;
+        case eltwise_abs: d = abs_fwd(s); break;
+        case eltwise_sqrt: d = sqrt_fwd(s); break;
+        case eltwise_linear: d = linear_fwd(s, alpha, beta); break;
+        case eltwise_bounded_relu:
+            d = bounded_relu_fwd(s, alpha); break;
+        case eltwise_soft_relu: d = soft_relu_fwd(s); break;
+        case eltwise_logistic: d = logistic_fwd(s); break;
+        default: assert(!"unknown eltwise alg_kind");
         }
-    }
+    });
 }
 
 template <impl::data_type_t data_type>
@@ -189,8 +183,7 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_dense() {
     src += data_d.blocking_desc().offset_padding;
     dst += data_d.blocking_desc().offset_padding;
 
-#   pragma omp parallel for schedule(static)
-    for (size_t e = 0; e < nelems; ++e) {
+    parallel_nd(nelems, [&](size_t e) {
         const data_t s = src[e];
         data_t &d = dst[e];
 
@@ -207,7 +200,7 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_dense() {
         case eltwise_logistic: d = logistic_fwd(s); break;
         default: assert(!"unknown eltwise alg_kind");
         }
-    }
+    });
 }
 
 template <impl::data_type_t data_type>
@@ -227,35 +220,28 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_generic() {
     const float alpha = conf_.desc()->alpha;
     const float beta = conf_.desc()->beta;
 
-#   pragma omp parallel for collapse(4) schedule(static)
-    for (int n = 0; n < MB; ++n) {
-        for (int c = 0; c < C; ++c) {
-            for (int h = 0; h < H; ++h) {
-                for (int w = 0; w < W; ++w) {
-                    auto data_off = data_d.off(n, c, h, w);
-                    auto diff_data_off = diff_data_d.off(n, c, h, w);
-                    data_t s = src[data_off];
-                    data_t dd = diff_dst[diff_data_off];
-                    data_t &ds = diff_src[diff_data_off];
-                    switch (alg_kind) {
-                    case eltwise_relu: ds = relu_bwd(dd, s, alpha); break;
-                    case eltwise_tanh: ds = tanh_bwd(dd, s); break;
-                    case eltwise_elu: ds = elu_bwd(dd, s, alpha); break;
-                    case eltwise_square: ds = square_bwd(dd, s); break;
-                    case eltwise_abs: ds = abs_bwd(dd, s); break;
-                    case eltwise_sqrt: ds = sqrt_bwd(dd, s); break;
-                    case eltwise_linear:
-                        ds = linear_bwd(dd, s, alpha, beta); break;
-                    case eltwise_bounded_relu:
-                        ds = bounded_relu_bwd(dd, s, alpha); break;
-                    case eltwise_soft_relu: ds = soft_relu_bwd(dd, s); break;
-                    case eltwise_logistic: ds = logistic_bwd(dd, s); break;
-                    default: assert(!"unknown eltwise alg_kind");
-                    }
-                }
-            }
+    parallel_nd(MB, C, H, W, [&](int n, int c, int h, int w) {
+        auto data_off = data_d.off(n, c, h, w);
+        auto diff_data_off = diff_data_d.off(n, c, h, w);
+        data_t s = src[data_off];
+        data_t dd = diff_dst[diff_data_off];
+        data_t &ds = diff_src[diff_data_off];
+        switch (alg_kind) {
+        case eltwise_relu: ds = relu_bwd(dd, s, alpha); break;
+        case eltwise_tanh: ds = tanh_bwd(dd, s); break;
+        case eltwise_elu: ds = elu_bwd(dd, s, alpha); break;
+        case eltwise_square: ds = square_bwd(dd, s); break;
+        case eltwise_abs: ds = abs_bwd(dd, s); break;
+        case eltwise_sqrt: ds = sqrt_bwd(dd, s); break;
+        case eltwise_linear:
+            ds = linear_bwd(dd, s, alpha, beta); break;
+        case eltwise_bounded_relu:
+            ds = bounded_relu_bwd(dd, s, alpha); break;
+        case eltwise_soft_relu: ds = soft_relu_bwd(dd, s); break;
+        case eltwise_logistic: ds = logistic_bwd(dd, s); break;
+        default: assert(!"unknown eltwise alg_kind");
         }
-    }
+    });
 }
 
 template <impl::data_type_t data_type>
@@ -276,8 +262,7 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_dense() {
     diff_dst += diff_data_d.blocking_desc().offset_padding;
     diff_src += diff_data_d.blocking_desc().offset_padding;
 
-#   pragma omp parallel for schedule(static)
-    for (size_t e = 0; e < nelems; ++e) {
+    parallel_nd(nelems, [&](size_t e) {
         const data_t dd = diff_dst[e];
         const data_t s = src[e];
         data_t &ds = diff_src[e];
@@ -295,7 +280,7 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_dense() {
         case eltwise_logistic: ds = logistic_bwd(dd, s); break;
         default: assert(!"unknown eltwise alg_kind");
         }
-    }
+    });
 }
 
 template struct ref_eltwise_fwd_t<data_type::f32>;
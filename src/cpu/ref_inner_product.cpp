@@ -65,18 +65,15 @@ void ref_inner_product_fwd_t<src_type, wei_type, dst_type, acc_type>
         }
     };
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int mb = 0; mb < MB; ++mb) {
-        for (int oc = 0; oc < OC; ++oc) {
-            acc_data_t a = bias ? bias[bias_d.off(oc)] : (dst_data_t)0;
-            if (src_has_spatial) {
-                ker_has_spatial(a, mb, oc);
-            } else {
-                ker_no_spatial(a, mb, oc);
-            }
-            dst[dst_d.off(mb, oc)] = (dst_data_t)a;
+    parallel_nd(MB, OC, [&](int mb, int oc) {
+        acc_data_t a = bias ? bias[bias_d.off(oc)] : (dst_data_t)0;
+        if (src_has_spatial) {
+            ker_has_spatial(a, mb, oc);
+        } else {
+            ker_no_spatial(a, mb, oc);
         }
-    }
+        dst[dst_d.off(mb, oc)] = (dst_data_t)a;
+    });
 }
 
 template struct ref_inner_product_fwd_t<f32>;
@@ -102,34 +99,31 @@ void ref_inner_product_bwd_data_t<diff_src_type, wei_type, diff_dst_type,
 
     const bool diff_src_has_spatial = diff_src_d.ndims() == 4;
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int mb = 0; mb < MB; ++mb) {
-        for (int ic = 0; ic < IC; ++ic) {
-            if (diff_src_has_spatial) {
-                const int KH = conf_.KH();
-                const int KW = conf_.KW();
-                for (int kh = 0; kh < KH; ++kh) {
-                    for (int kw = 0; kw < KW; ++kw) {
-                        acc_data_t ds = acc_data_t(0);
-                        for (int oc = 0; oc < OC; ++oc) {
-                            ds += (acc_data_t)(
-                                diff_dst[diff_dst_d.off(mb, oc)]
-                                * weights[weights_d.off(oc, ic, kh, kw)]);
-                        }
-                        diff_src[diff_src_d.off(mb, ic, kh, kw)]
-                            = (diff_src_data_t)ds;
+    parallel_nd(MB, IC, [&](int mb, int ic) {
+        if (diff_src_has_spatial) {
+            const int KH = conf_.KH();
+            const int KW = conf_.KW();
+            for (int kh = 0; kh < KH; ++kh) {
+                for (int kw = 0; kw < KW; ++kw) {
+                    acc_data_t ds = acc_data_t(0);
+                    for (int oc = 0; oc < OC; ++oc) {
+                        ds += (acc_data_t)(
+                            diff_dst[diff_dst_d.off(mb, oc)]
+                            * weights[weights_d.off(oc, ic, kh, kw)]);
                     }
+                    diff_src[diff_src_d.off(mb, ic, kh, kw)]
+                        = (diff_src_data_t)ds;
                 }
-            } else {
-                acc_data_t ds = acc_data_t(0);
-                for (int oc = 0; oc < OC; ++oc) {
-                    ds += (acc_data_t)(diff_dst[diff_dst_d.off(mb, oc)] *
-                        weights[weights_d.off(oc, ic)]);
-                }
-                diff_src[diff_src_d.off(mb, ic)] = (diff_src_data_t)ds;
             }
+        } else {
+            acc_data_t ds = acc_data_t(0);
+            for (int oc = 0; oc < OC; ++oc) {
+                ds += (acc_data_t)(diff_dst[diff_dst_d.off(mb, oc)] *
+                    weights[weights_d.off(oc, ic)]);
+            }
+            diff_src[diff_src_d.off(mb, ic)] = (diff_src_data_t)ds;
         }
-    }
+    });
 }
 
 template struct ref_inner_product_bwd_data_t<f32, f32, f32, f32>;
@@ -155,43 +149,37 @@ void ref_inner_product_bwd_weights_t<data_type>::execute_backward_weights() {
 
     const bool src_has_spatial = src_d.ndims() == 4;
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int oc = 0; oc < OC; ++oc) {
-        for (int ic = 0; ic < IC; ++ic) {
-            if (src_has_spatial) {
-                const int KH = conf_.KH();
-                const int KW = conf_.KW();
-                for (int kh = 0; kh < KH; ++kh) {
-                    for (int kw = 0; kw < KW; ++kw) {
-                        data_t *dw = &diff_weights[
-                            diff_weights_d.off(oc, ic, kh, kw)];
-                        *dw = data_t(0);
-                        for (int mb = 0; mb < MB; ++mb) {
-                            *dw += diff_dst[diff_dst_d.off(mb, oc)] *
-                                src[src_d.off(mb, ic, kh, kw)];
-                        }
+    parallel_nd(OC, IC, [&](int oc, int ic) {
+        if (src_has_spatial) {
+            const int KH = conf_.KH();
+            const int KW = conf_.KW();
+            for (int kh = 0; kh < KH; ++kh) {
+                for (int kw = 0; kw < KW; ++kw) {
+                    data_t *dw = &diff_weights[
+                        diff_weights_d.off(oc, ic, kh, kw)];
+                    *dw = data_t(0);
+                    for (int mb = 0; mb < MB; ++mb) {
+                        *dw += diff_dst[diff_dst_d.off(mb, oc)] *
+                            src[src_d.off(mb, ic, kh, kw)];
                     }
                 }
-            } else {
-                data_t *dw = &diff_weights[diff_weights_d.off(oc, ic)];
-                *dw = data_t(0);
-                for (int mb = 0; mb < MB; ++mb) {
-                    *dw += diff_dst[diff_dst_d.off(mb, oc)] *
-                        src[src_d.off(mb, ic)];
-                }
+            }
+        } else {
+            data_t *dw = &diff_weights[diff_weights_d.off(oc, ic)];
+            *dw = data_t(0);
+            for (int mb = 0; mb < MB; ++mb) {
+                *dw += diff_dst[diff_dst_d.off(mb, oc)] *
+                    src[src_d.off(mb, ic)];
             }
         }
-    }
+    });
 
     if (diff_bias) {
         diff_bias += diff_bias_d.blocking_desc().offset_padding;
         constexpr int blksize = 8;
         int OC_blocks = OC / blksize;
         int rem_OC = OC % blksize;
-#       pragma omp parallel
-        {
-            const int ithr = omp_get_thread_num();
-            const int nthr = omp_get_num_threads();
+        parallel(0, [&](const int ithr, const int nthr) {
             int oc_st{0}, oc_e{0};
             balance211(OC_blocks, nthr, ithr, oc_st, oc_e);
             oc_st = oc_st * blksize;
@@ -218,7 +206,7 @@ void ref_inner_product_bwd_weights_t<data_type>::execute_backward_weights() {
                     }
                 }
             }
-        }
+        });
     }
 }
 
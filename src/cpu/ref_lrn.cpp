@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "type_helpers.hpp"
+#include "mkldnn_thread.hpp"
 
 #include "ref_lrn.hpp"
 
@@ -76,16 +77,9 @@ void ref_lrn_fwd_t<data_type>::execute_forward() {
     };
 
     const int MB = conf_.MB();
-#   pragma omp parallel for collapse(4) schedule(static)
-    for (int mb = 0; mb < MB; ++mb) {
-        for (int c = 0; c < C; ++c) {
-            for (int h = 0; h < H; ++h) {
-                for (int w = 0; w < W; ++w) {
-                    ker(&dst[data_d.off(mb, c, h, w)], mb, c, h, w);
-                }
-            }
-        }
-    }
+    parallel_nd(MB, C, H, W, [&](int mb, int c, int h, int w) {
+        ker(&dst[data_d.off(mb, c, h, w)], mb, c, h, w);
+    });
 }
 
 template <impl::data_type_t data_type>
@@ -149,16 +143,9 @@ void ref_lrn_bwd_t<data_type>::execute_backward() {
         *d = static_cast<data_t>(A - B); // final cast down to data_t
     };
 
-#   pragma omp parallel for collapse(4) schedule(static)
-    for (int mb = 0; mb < MB; ++mb) {
-        for (int c = 0; c < C; ++c) {
-            for (int h = 0; h < H; ++h) {
-                for (int w = 0; w < W; ++w) {
-                    ker(&diff_src[diff_data_d.off(mb, c, h, w)], mb, c, h, w);
-                }
-            }
-        }
-    }
+    parallel_nd(MB, C, H, W, [&](int mb, int c, int h, int w) {
+        ker(&diff_src[diff_data_d.off(mb, c, h, w)], mb, c, h, w);
+    });
 
 }
 
@@ -21,6 +21,7 @@
 #include "type_helpers.hpp"
 #include "math_utils.hpp"
 #include "nstl.hpp"
+#include "mkldnn_thread.hpp"
 
 #include "ref_pooling.hpp"
 
@@ -109,34 +110,20 @@ void ref_pooling_fwd_t<data_type, acc_type>::execute_forward() {
     const int OW = conf_.OW();
 
     if (alg == pooling_max) {
-#       pragma omp parallel for collapse(4) schedule(static)
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int oc = 0; oc < OC; ++oc) {
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        data_t *d = &dst[dst_d.off(mb, oc, oh, ow)];
-                        d[0] = nstl::numeric_limits<data_t>::lowest();
-                        if (ws) {
-                            ws[ws_d.off(mb, oc, oh, ow)] = 0;
-                        }
-                        ker_max(d, mb, oc, oh, ow);
-                    }
-                }
+        parallel_nd(MB, OC, OH, OW, [&](int mb, int oc, int oh, int ow) {
+            data_t *d = &dst[dst_d.off(mb, oc, oh, ow)];
+            d[0] = nstl::numeric_limits<data_t>::lowest();
+            if (ws) {
+                ws[ws_d.off(mb, oc, oh, ow)] = 0;
             }
-        }
+            ker_max(d, mb, oc, oh, ow);
+        });
     } else {
-#       pragma omp parallel for collapse(4) schedule(static)
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int oc = 0; oc < OC; ++oc) {
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        data_t *d = &dst[dst_d.off(mb, oc, oh, ow)];
-                        d[0] = 0;
-                        ker_avg(d, mb, oc, oh, ow);
-                    }
-                }
-            }
-        }
+        parallel_nd(MB, OC, OH, OW, [&](int mb, int oc, int oh, int ow) {
+            data_t *d = &dst[dst_d.off(mb, oc, oh, ow)];
+            d[0] = 0;
+            ker_avg(d, mb, oc, oh, ow);
+        });
     }
 }
 
@@ -210,33 +197,27 @@ void ref_pooling_bwd_t<data_type, acc_type>::execute_backward() {
     const int OW = conf_.OW();
 
     if (conf_.desc()->alg_kind == alg_kind::pooling_max) {
-#       pragma omp parallel for collapse(2) schedule(static)
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int oc = 0; oc < OC; ++oc) {
-                ker_zero(mb, oc);
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        const data_t *d =
-                            &diff_dst[diff_dst_d.off(mb, oc, oh, ow)];
-                        ker_max(d, mb, oc, oh, ow);
-                    }
+        parallel_nd(MB, OC, [&](int mb, int oc) {
+            ker_zero(mb, oc);
+            for (int oh = 0; oh < OH; ++oh) {
+                for (int ow = 0; ow < OW; ++ow) {
+                    const data_t *d =
+                        &diff_dst[diff_dst_d.off(mb, oc, oh, ow)];
+                    ker_max(d, mb, oc, oh, ow);
                 }
             }
-        }
+        });
     } else {
-#       pragma omp parallel for collapse(2) schedule(static)
-        for (int mb = 0; mb < MB; ++mb) {
-            for (int oc = 0; oc < OC; ++oc) {
-                ker_zero(mb, oc);
-                for (int oh = 0; oh < OH; ++oh) {
-                    for (int ow = 0; ow < OW; ++ow) {
-                        const data_t *d =
-                            &diff_dst[diff_dst_d.off(mb, oc, oh, ow)];
-                        ker_avg(d, mb, oc, oh, ow);
-                    }
+        parallel_nd(MB, OC, [&](int mb, int oc) {
+            ker_zero(mb, oc);
+            for (int oh = 0; oh < OH; ++oh) {
+                for (int ow = 0; ow < OW; ++ow) {
+                    const data_t *d =
+                        &diff_dst[diff_dst_d.off(mb, oc, oh, ow)];
+                    ker_avg(d, mb, oc, oh, ow);
                 }
             }
-        }
+        });
     }
 }
 
@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "type_helpers.hpp"
+#include "mkldnn_thread.hpp"
 
 #include "ref_softmax.hpp"
 
@@ -36,8 +37,7 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense() {
     auto src = reinterpret_cast<const data_t *>(this->input_memory(0));
     auto dst = reinterpret_cast<data_t *>(this->memory(0));
 
-#   pragma omp parallel for schedule(static)
-    for (int ou = 0; ou < outer_size_; ou++) {
+    parallel_nd(outer_size_, [&](int ou) {
         const data_t *src_data = src + ou * channels_;
         data_t *dst_data = dst + ou * channels_;
         data_t scalar = 0;
@@ -47,7 +47,7 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense() {
         _exp(channels_, dst_data, dst_data);
         _sum(channels_, dst_data, &scalar);
         _scal(channels_, data_t(1)/scalar, dst_data);
-    }
+    });
 }
 
 template <impl::data_type_t data_type>
@@ -109,9 +109,7 @@ void ref_softmax_fwd_t<data_type>::_exp(int n, const data_t *a, data_t *r) {
         return;
     }
 #endif
-#   pragma omp parallel for
-    for (int c = 0; c < n; ++c)
-        r[c] = expf(a[c]);
+    parallel_nd(n, [&](int c) { r[c] = expf(a[c]); });
 }
 
 template <impl::data_type_t data_type>
@@ -130,9 +128,7 @@ void ref_softmax_fwd_t<data_type>::_scal(int n, data_t alpha, data_t *x) {
         return;
     }
 #endif
-#   pragma omp parallel for
-    for (int c = 0; c < n; ++c)
-        x[c] *= alpha;
+    parallel_nd(n, [&](int c) { x[c] *= alpha; });
 }
 
 template struct ref_softmax_fwd_t<data_type::f32>;
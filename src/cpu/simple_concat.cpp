@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "mkldnn_thread.hpp"
+
 #include "simple_concat.hpp"
 
 namespace mkldnn {
@@ -46,15 +48,12 @@ void simple_concat_t<data_type>::execute() {
     const int N = o_d.dims()[0];
     const size_t os = size_t(o_d.blocking_desc().strides[0][0]);
 
-#   pragma omp parallel for collapse(2) schedule(static)
-    for (int n = 0; n < N; ++n) {
-        for (int a = 0; a < num_arrs; ++a) {
-            /* do coping */
-            const data_t *i = &input_ptrs[a][is[a] * size_t(n)];
-            data_t *o = &output_ptrs[a][os * size_t(n)];
-            for (size_t e = 0; e < nelems_no_d0[a]; ++e) o[e] = i[e];
-        }
-    }
+    parallel_nd(N, num_arrs, [&](int n, int a) {
+        /* do coping */
+        const data_t *i = &input_ptrs[a][is[a] * size_t(n)];
+        data_t *o = &output_ptrs[a][os * size_t(n)];
+        for (size_t e = 0; e < nelems_no_d0[a]; ++e) o[e] = i[e];
+    });
 }
 
 template struct simple_concat_t<data_type::f32>;
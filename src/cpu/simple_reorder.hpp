@@ -133,18 +133,14 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(3) schedule(static)
-        for (int n = 0; n < dims[0]; ++n) {
-            for (int C = 0; C < dims[1] / blksize; ++C) {
-                for (int h = 0; h < dims[2]; ++h) {
-                    constexpr int i_c_mult = order_keep ? blksize : 1;
-                    constexpr int o_c_mult = order_keep ? 1 : blksize;
-                    auto i = &input[input_d.blk_off(n, i_c_mult * C, h)];
-                    auto o = &output[output_d.blk_off(n, o_c_mult * C, h)];
-                    ker(i, o);
-                }
-            }
-        }
+        parallel_nd(dims[0], dims[1] / blksize, dims[2],
+                [&](int n, int C, int h) {
+            constexpr int i_c_mult = order_keep ? blksize : 1;
+            constexpr int o_c_mult = order_keep ? 1 : blksize;
+            auto i = &input[input_d.blk_off(n, i_c_mult * C, h)];
+            auto o = &output[output_d.blk_off(n, o_c_mult * C, h)];
+            ker(i, o);
+        });
 
         return success;
     }
@@ -257,16 +253,11 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(3) schedule(static)
-        for (int n = 0; n < dims[0]; ++n) {
-            for (int h = 0; h < dims[2]; ++h) {
-                for (int w = 0; w < dims[3]; ++w) {
-                    auto i = &input[input_d.blk_off(n, 0, h, w)];
-                    auto o = &output[output_d.blk_off(n, 0, h, w)];
-                    ker(i, o);
-                }
-            }
-        }
+        parallel_nd(dims[0], dims[2], dims[3], [&](int n, int h, int w) {
+            auto i = &input[input_d.blk_off(n, 0, h, w)];
+            auto o = &output[output_d.blk_off(n, 0, h, w)];
+            ker(i, o);
+        });
 
         return success;
     }
@@ -322,22 +313,16 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(4) schedule(static)
-        for (int C = 0; C < dims[1] / blksize; ++C) {
-            for (int h = 0; h < dims[2]; ++h) {
-                for (int n = 0; n < dims[0]; n += tsize) {
-                    for (int w = 0; w < dims[3]; ++w) {
-                        const int nsize =
-                            n + tsize > dims[0] ? dims[0] - n : tsize;
-                        auto i = &input[n * i_st[0] + C * i_mult * i_st[1]
-                            + h * i_st[2] + w * i_st[3]];
-                        auto o = &output[n * o_st[0] + C * o_mult * o_st[1]
-                            + h * o_st[2] + w * o_st[3]];
-                        ker(i, o, nsize);
-                    }
-                }
-            }
-        }
+        parallel_nd(dims[1] / blksize, dims[2], utils::div_up(dims[0], tsize),
+                dims[3], [&](int C, int h, int n_blk, int w) {
+            const int n = n_blk * tsize;
+            const int nsize = n + tsize > dims[0] ? dims[0] - n : tsize;
+            auto i = &input[n * i_st[0] + C * i_mult * i_st[1]
+                + h * i_st[2] + w * i_st[3]];
+            auto o = &output[n * o_st[0] + C * o_mult * o_st[1]
+                + h * o_st[2] + w * o_st[3]];
+            ker(i, o, nsize);
+        });
 
         return success;
     }
@@ -393,18 +378,12 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(4) schedule(static)
-        for (int n = 0; n < dims[0]; ++n) {
-            for (int C = 0; C < dims[1] / blksize_16c; ++C) {
-                for (int h = 0; h < dims[2]; ++h) {
-                    for (int w = 0; w < dims[3]; ++w) {
-                        auto i = &input[input_d.blk_off(n, C * ic_mult, h, w)];
-                        auto o = &output[output_d.blk_off(n, C * oc_mult, h, w)];
-                        ker(i,o);
-                    }
-                }
-            }
-        }
+        parallel_nd(dims[0], dims[1] / blksize_16c, dims[2], dims[3],
+                [&](int n, int C, int h, int w) {
+            auto i = &input[input_d.blk_off(n, C * ic_mult, h, w)];
+            auto o = &output[output_d.blk_off(n, C * oc_mult, h, w)];
+            ker(i,o);
+        });
 
         return success;
     }
@@ -514,14 +493,11 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(2) schedule(static)
-        for (int n = 0; n < dims[0]; ++n) {
-            for (int h = 0; h < dims[2]; ++h) {
-                auto i = &input[input_d.blk_off(n, 0, h)];
-                auto o = &output[output_d.blk_off(n, 0, h)];
-                ker(i, o);
-            }
-        }
+        parallel_nd(dims[0], dims[2], [&](int n, int h) {
+            auto i = &input[input_d.blk_off(n, 0, h)];
+            auto o = &output[output_d.blk_off(n, 0, h)];
+            ker(i, o);
+        });
 
         return success;
     }
@@ -570,14 +546,11 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(2) schedule(static)
-        for (int ic = 0; ic < dims[1]; ++ic) {
-            for (int kh = 0; kh < dims[2]; ++kh) {
-                auto i = &input[input_d.blk_off(0, ic, kh)];
-                auto o = &output[output_d.blk_off(0, ic, kh)];
-                ker(i, o);
-            }
-        }
+        parallel_nd(dims[1], dims[2], [&](int ic, int kh) {
+            auto i = &input[input_d.blk_off(0, ic, kh)];
+            auto o = &output[output_d.blk_off(0, ic, kh)];
+            ker(i, o);
+        });
 
         return success;
     }
@@ -633,17 +606,16 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(2) schedule(static)
-        for (int r = 0; r < dims[0]; r += tsize) {
-            for (int c = 0; c < CHW; c += tsize) {
-                const int nrows =
-                    r + tsize > dims[0] ? dims[0] - r : tsize;
-                const int ncols = c + tsize > CHW ? CHW - c : tsize;
-                auto i = &input[r * istrides[0] + c * istrides[3]];
-                auto o = &output[r * ostrides[0] + c * ostrides[3]];
-                ker(i, o, nrows, ncols);
-            }
-        }
+        parallel_nd(utils::div_up(dims[0], tsize), utils::div_up(CHW, tsize),
+                [&](int r_blk, int c_blk) {
+            const int r = r_blk * tsize;
+            const int c = c_blk * tsize;
+            const int nrows = r + tsize > dims[0] ? dims[0] - r : tsize;
+            const int ncols = c + tsize > CHW ? CHW - c : tsize;
+            auto i = &input[r * istrides[0] + c * istrides[3]];
+            auto o = &output[r * ostrides[0] + c * ostrides[3]];
+            ker(i, o, nrows, ncols);
+        });
 
         return success;
     }
@@ -699,16 +671,11 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(3) schedule(static)
-        for (int h = 0; h < dims[2]; ++h) {
-            for (int w = 0; w < dims[3]; ++w) {
-                for (int ic = 0; ic < dims[1]; ++ic) {
-                    auto i = &input[input_d.blk_off(0, ic, h, w)];
-                    auto o = &output[output_d.blk_off(0, ic, h, w)];
-                    ker(i, o);
-                }
-            }
-        }
+        parallel_nd(dims[2], dims[3], dims[1], [&](int h, int w, int ic) {
+            auto i = &input[input_d.blk_off(0, ic, h, w)];
+            auto o = &output[output_d.blk_off(0, ic, h, w)];
+            ker(i, o);
+        });
 
         return success;
     }
@@ -777,24 +744,17 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
         const int _G = w_groups ? dims[0] : 1;
 
-#       pragma omp parallel for collapse(5) schedule(static)
-        for (int g = 0; g < _G; ++g) {
-            for (int O = 0; O < dims[w_groups + 0] / blksize; ++O) {
-                for (int I = 0; I < dims[w_groups + 1] / blksize; ++I) {
-                    for (int h = 0; h < dims[w_groups + 2]; ++h) {
-                        for (int w = 0; w < dims[w_groups + 3]; ++w) {
-                            constexpr int i_mult = order_keep ? blksize : 1;
-                            constexpr int o_mult = order_keep ? 1 : blksize;
-                            auto i = &input[input_d.blk_off<!w_groups>(g,
-                                    i_mult * O, i_mult * I, h, w)];
-                            auto o = &output[output_d.blk_off<!w_groups>(
-                                    g, o_mult * O, o_mult * I, h, w)];
-                            ker(i, o);
-                        }
-                    }
-                }
-            }
-        }
+        parallel_nd(_G, dims[w_groups + 0] / blksize,
+                dims[w_groups + 1] / blksize, dims[w_groups + 2],
+                dims[w_groups + 3], [&](int g, int O, int I, int h, int w) {
+            constexpr int i_mult = order_keep ? blksize : 1;
+            constexpr int o_mult = order_keep ? 1 : blksize;
+            auto i = &input[input_d.blk_off<!w_groups>(g,
+                    i_mult * O, i_mult * I, h, w)];
+            auto o = &output[output_d.blk_off<!w_groups>(
+                    g, o_mult * O, o_mult * I, h, w)];
+            ker(i, o);
+        });
 
         return success;
     }
@@ -864,24 +824,17 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
         const int _G = w_groups ? dims[0] : 1;
 
-#       pragma omp parallel for collapse(5) schedule(static)
-        for (int g = 0; g < _G; ++g) {
-            for (int O = 0; O < dims[w_groups + 0] / blksize; ++O) {
-                for (int I = 0; I < dims[w_groups + 1] / blksize; ++I) {
-                    for (int h = 0; h < dims[w_groups + 2]; ++h) {
-                        for (int w = 0; w < dims[w_groups + 3]; ++w) {
-                            constexpr int i_mult = order_keep ? blksize : 1;
-                            constexpr int o_mult = order_keep ? 1 : blksize;
-                            auto i = &input[input_d.blk_off<!w_groups>(g,
-                                    i_mult * O, i_mult * I, h, w)];
-                            auto o = &output[output_d.blk_off<!w_groups>(
-                                    g, o_mult * O, o_mult * I, h, w)];
-                            ker(i, o);
-                        }
-                    }
-                }
-            }
-        }
+        parallel_nd(_G, dims[w_groups + 0] / blksize,
+                dims[w_groups + 1] / blksize, dims[w_groups + 2],
+                dims[w_groups + 3], [&](int g, int O, int I, int h, int w) {
+            constexpr int i_mult = order_keep ? blksize : 1;
+            constexpr int o_mult = order_keep ? 1 : blksize;
+            auto i = &input[input_d.blk_off<!w_groups>(g,
+                    i_mult * O, i_mult * I, h, w)];
+            auto o = &output[output_d.blk_off<!w_groups>(
+                    g, o_mult * O, o_mult * I, h, w)];
+            ker(i, o);
+        });
 
         return success;
     }
@@ -915,44 +868,37 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         constexpr int i_mult = order_keep ? blksize : 1;
         constexpr int o_mult = order_keep ? 1 : blksize;
 
-#       pragma omp parallel for collapse(5) schedule(static)
-        for (int g = 0; g < _G; ++g) {
-            for (int O = 0; O < dims[w_groups + 0] / blksize; ++O) {
-                for (int i = 0; i < dims[w_groups + 1]; ++i) {
-                    for (int h = 0; h < dims[w_groups + 2]; ++h) {
-                        for (int w = 0; w < dims[w_groups + 3]; ++w) {
-                            auto inp = &input [input_d.blk_off<!w_groups>(g,
-                                    i_mult * O, i, h, w)];
-                            auto out = &output[output_d.blk_off<!w_groups>(g,
-                                    o_mult * O, i, h, w)];
-                            if (alpha == 1.0 && beta == 0.0) {
-                                for (int oc = 0; oc < blksize; ++oc) {
-                                    const auto off = oc * strd_oc;
-                                    if (order_keep) {
-                                        out[oc] = data_t<type_o>(inp[off]);
-                                    } else {
-                                        out[off] = data_t<type_o>(inp[oc]);
-                                    }
-                                }
-                            } else {
-                                for (int oc = 0; oc < blksize; ++oc) {
-                                    const auto off = oc * strd_oc;
-                                    if (order_keep) {
-                                        out[oc] = data_t<type_o>(
-                                                alpha * inp[off] + (beta
-                                                    ? beta * out[oc] : 0));
-                                    } else {
-                                        out[off] = data_t<type_o>(
-                                                alpha * inp[oc] + (beta
-                                                    ? beta * out[off] : 0));
-                                    }
-                                }
-                            }
-                        }
+        parallel_nd(_G, dims[w_groups + 0] / blksize, dims[w_groups + 1],
+                dims[w_groups + 2], dims[w_groups + 3],
+                [&](int g, int O, int i, int h, int w) {
+            auto inp = &input [input_d.blk_off<!w_groups>(g,
+                    i_mult * O, i, h, w)];
+            auto out = &output[output_d.blk_off<!w_groups>(g,
+                    o_mult * O, i, h, w)];
+            if (alpha == 1.0 && beta == 0.0) {
+                for (int oc = 0; oc < blksize; ++oc) {
+                    const auto off = oc * strd_oc;
+                    if (order_keep) {
+                        out[oc] = data_t<type_o>(inp[off]);
+                    } else {
+                        out[off] = data_t<type_o>(inp[oc]);
+                    }
+                }
+            } else {
+                for (int oc = 0; oc < blksize; ++oc) {
+                    const auto off = oc * strd_oc;
+                    if (order_keep) {
+                        out[oc] = data_t<type_o>(
+                                alpha * inp[off] + (beta
+                                    ? beta * out[oc] : 0));
+                    } else {
+                        out[off] = data_t<type_o>(
+                                alpha * inp[oc] + (beta
+                                    ? beta * out[off] : 0));
                     }
                 }
             }
-        }
+        });
 
         return success;
     }
@@ -1008,22 +954,16 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
             }
         };
 
-#       pragma omp parallel for collapse(4) schedule(static)
-        for (int h = 0; h < dims[2]; ++h) {
-            for (int w = 0; w < dims[3]; ++w) {
-                for (int O = 0; O < dims[0] / blksize; ++O) {
-                    for (int I = 0; I < dims[1] / blksize; ++I) {
-                        constexpr int i_mult = order_keep ? blksize : 1;
-                        constexpr int o_mult = order_keep ? 1 : blksize;
-                        auto i = &input[input_d.blk_off(
-                                i_mult * O, i_mult * I, h, w)];
-                        auto o = &output[output_d.blk_off(
-                                o_mult * O, o_mult * I, h, w)];
-                        ker(i, o);
-                    }
-                }
-            }
-        }
+        parallel_nd(dims[2], dims[3], dims[0] / blksize, dims[1] / blksize,
+                [&](int h, int w, int O, int I) {
+            constexpr int i_mult = order_keep ? blksize : 1;
+            constexpr int o_mult = order_keep ? 1 : blksize;
+            auto i = &input[input_d.blk_off(
+                    i_mult * O, i_mult * I, h, w)];
+            auto o = &output[output_d.blk_off(
+                    o_mult * O, o_mult * I, h, w)];
+            ker(i, o);
+        });
 
         return success;
     }
@@ -1094,24 +1034,17 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
         const int _G = w_groups ? dims[0] : 1;
 
-#       pragma omp parallel for collapse(5) schedule(static)
-        for (int g = 0; g < _G; ++g) {
-            for (int O = 0; O < dims[w_groups + 0] / blksize; ++O) {
-                for (int I = 0; I < dims[w_groups + 1] / blksize; ++I) {
-                    for (int h = 0; h < dims[w_groups + 2]; ++h) {
-                        for (int w = 0; w < dims[w_groups + 3]; ++w) {
-                            constexpr int i_mult = order_keep ? blksize : 1;
-                            constexpr int o_mult = order_keep ? 1 : blksize;
-                            auto i = &input[input_d.blk_off<!w_groups>(g,
-                                    i_mult * O, i_mult * I, h, w)];
-                            auto o = &output[output_d.blk_off<!w_groups>(
-                                    g, o_mult * O, o_mult * I, h, w)];
-                            ker(i, o);
-                        }
-                    }
-                }
-            }
-        }
+        parallel_nd(_G, dims[w_groups + 0] / blksize,
+                dims[w_groups + 1] / blksize, dims[w_groups + 2],
+                dims[w_groups + 3], [&](int g, int O, int I, int h, int w) {
+            constexpr int i_mult = order_keep ? blksize : 1;
+            constexpr int o_mult = order_keep ? 1 : blksize;
+            auto i = &input[input_d.blk_off<!w_groups>(g,
+                    i_mult * O, i_mult * I, h, w)];
+            auto o = &output[output_d.blk_off<!w_groups>(
+                    g, o_mult * O, o_mult * I, h, w)];
+            ker(i, o);
+        });
         return success;
     }
 };
@@ -1165,22 +1098,15 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
         const int _G = w_groups ? dims[0] : 1;
 
-#       pragma omp parallel for collapse(5) schedule(static)
-        for (int g = 0; g < _G; ++g) {
-            for (int o = 0; o < dims[w_groups + 0] / blksize; ++o) {
-                for (int i = 0; i < dims[w_groups + 1] / blksize; ++i) {
-                    for (int h = 0; h < dims[w_groups + 2]; ++h) {
-                        for (int w = 0; w < dims[w_groups + 3]; ++w) {
-                            auto i_ptr = &input[input_d.blk_off<!w_groups>(g,
-                                    o, i, h, w)];
-                            auto o_ptr = &output[output_d.blk_off<!w_groups>(g,
-                                    o, i, h, w)];
-                            ker(i_ptr, o_ptr);
-                        }
-                    }
-                }
-            }
-        }
+        parallel_nd(_G, dims[w_groups + 0] / blksize,
+                dims[w_groups + 1] / blksize, dims[w_groups + 2],
+                dims[w_groups + 3], [&](int g, int o, int i, int h, int w) {
+            auto i_ptr = &input[input_d.blk_off<!w_groups>(g,
+                    o, i, h, w)];
+            auto o_ptr = &output[output_d.blk_off<!w_groups>(g,
+                    o, i, h, w)];
+            ker(i_ptr, o_ptr);
+        });
 
         return success;
     }
@@ -1228,22 +1154,15 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
         const int _G = w_groups ? dims[0] : 1;
 
-#       pragma omp parallel for collapse(5) schedule(static)
-        for (int g = 0; g < _G; ++g) {
-            for (int o = 0; o < dims[w_groups + 0] / blksize; ++o) {
-                for (int i = 0; i < dims[w_groups + 1] / blksize; ++i) {
-                    for (int h = 0; h < dims[w_groups + 2]; ++h) {
-                        for (int w = 0; w < dims[w_groups + 3]; ++w) {
-                            auto i_ptr = &input[input_d.blk_off<!w_groups>(g,
-                                    o, i, h, w)];
-                            auto o_ptr = &output[output_d.blk_off<!w_groups>(g,
-                                    o, i, h, w)];
-                            ker(i_ptr, o_ptr);
-                        }
-                    }
-                }
-            }
-        }
+        parallel_nd(_G, dims[w_groups + 0] / blksize,
+                dims[w_groups + 1] / blksize, dims[w_groups + 2],
+                dims[w_groups + 3], [&](int g, int o, int i, int h, int w) {
+            auto i_ptr = &input[input_d.blk_off<!w_groups>(g,
+                    o, i, h, w)];
+            auto o_ptr = &output[output_d.blk_off<!w_groups>(g,
+                    o, i, h, w)];
+            ker(i_ptr, o_ptr);
+        });
 
         return success;
     }
@@ -1273,27 +1192,20 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
 
         const int _G = w_groups ? dims[0] : 1;
 
-#       pragma omp parallel for collapse(5) schedule(static)
-        for (int g = 0; g < _G; ++g) {
-            for (int o = 0; o < dims[w_groups + 0] / blksize; ++o) {
-                for (int i = 0; i < dims[w_groups + 1]; ++i) {
-                    for (int h = 0; h < dims[w_groups + 2]; ++h) {
-                        for (int w = 0; w < dims[w_groups + 3]; ++w) {
-                            auto i_ptr = &input[input_d.blk_off<!w_groups>(g,
-                                    o, i, h, w)];
-                            auto o_ptr = &output[output_d.blk_off<!w_groups>(g,
-                                    o, i, h, w)];
-                            for (int oc = 0; oc < blksize; ++oc) {
-                                o_ptr[oc] = (alpha == 1.0 && beta == 0.0)
-                                    ? data_t<type_o>(i_ptr[oc])
-                                    : data_t<type_o>(alpha * i_ptr[oc]
-                                        + (beta ? beta * o_ptr[oc] : 0));
-                            }
-                        }
-                    }
-                }
+        parallel_nd(_G, dims[w_groups + 0] / blksize, dims[w_groups + 1],
+                dims[w_groups + 2], dims[w_groups + 3],
+                [&](int g, int o, int i, int h, int w) {
+            auto i_ptr = &input[input_d.blk_off<!w_groups>(g,
+                    o, i, h, w)];
+            auto o_ptr = &output[output_d.blk_off<!w_groups>(g,
+                    o, i, h, w)];
+            for (int oc = 0; oc < blksize; ++oc) {
+                o_ptr[oc] = (alpha == 1.0 && beta == 0.0)
+                    ? data_t<type_o>(i_ptr[oc])
+                    : data_t<type_o>(alpha * i_ptr[oc]
+                        + (beta ? beta * o_ptr[oc] : 0));
             }
-        }
+        });
 
         return success;
     }
@@ -1326,10 +1238,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const auto num_blocks = nelems / block_size;
         const auto rem_elems = nelems % block_size;
 
-#       pragma omp parallel
-        {
-            const int ithr = omp_get_thread_num();
-            const int nthr = omp_get_num_threads();
+        parallel(0, [&](const int ithr, const int nthr) {
             size_t start{0}, end{0};
             balance211(num_blocks, nthr, ithr, start, end);
             start = start * block_size;
@@ -1389,7 +1298,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                    }
                }
             }
-        }
+        });
         return success;
     }
 };
@@ -1424,10 +1333,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const size_t work_amount = N * nelems_no_d0;
 
         if (alpha == 1.0 && beta == 0.0) {
-#           pragma omp parallel
-            {
-                const int ithr = omp_get_thread_num();
-                const int nthr = omp_get_num_threads();
+            parallel(0, [&](const int ithr, const int nthr) {
                 size_t n{0}, dim1_s{0};
                 size_t start{0}, end{0};
                 balance211(work_amount, nthr, ithr, start, end);
@@ -1443,12 +1349,9 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                     }
                     nd_iterator_jump(start, end, n, N, dim1_s, nelems_no_d0);
                 }
-            }
+            });
         } else {
-#           pragma omp parallel
-            {
-                const int ithr = omp_get_thread_num();
-                const int nthr = omp_get_num_threads();
+            parallel(0, [&](const int ithr, const int nthr) {
                 size_t n{0}, dim1_s{0};
                 size_t start{0}, end{0};
                 balance211(work_amount, nthr, ithr, start, end);
@@ -1466,7 +1369,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                     }
                     nd_iterator_jump(start, end, n, N, dim1_s, nelems_no_d0);
                 }
-            }
+            });
         }
 
         return success;
@@ -1513,12 +1416,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         const size_t nelems = input_d.nelems();
 
         if (type_o != f32) {
-#           if _OPENMP >= 201307
-#           pragma omp parallel for simd schedule(static)
-#           else
-#           pragma omp parallel for
-#           endif
-            for (size_t e = 0; e < nelems; ++e) {
+            parallel_nd(nelems, [&](size_t e) {
                 float i = (float)input[input_d.off_l(e)];
                 auto &o = output[output_d.off_l(e)];
 
@@ -1528,29 +1426,19 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                     case round_mode::nearest: i = rintf(i); break;
                 }
                 o = saturate<data_t<type_o>>(i);
-            }
+            });
         } else {
             if (alpha == 1.0 && beta == 0.0) {
-#               if _OPENMP >= 201307
-#               pragma omp parallel for simd schedule(static)
-#               else
-#               pragma omp parallel for
-#               endif
-                for (size_t e = 0; e < nelems; ++e) {
+                parallel_nd(nelems, [&](size_t e) {
                     output[output_d.off_l(e)] =
                         data_t<type_o>(input[input_d.off_l(e)]);
-                }
+                });
             } else {
-#               if _OPENMP >= 201307
-#               pragma omp parallel for simd schedule(static)
-#               else
-#               pragma omp parallel for
-#               endif
-                for (size_t e = 0; e < nelems; ++e) {
+                parallel_nd(nelems, [&](size_t e) {
                     output[output_d.off_l(e)] =
                         data_t<type_o>(alpha * input[input_d.off_l(e)]
                         + (beta ? beta * output[output_d.off_l(e)] : 0));
-                }
+                });
             }
         }
 
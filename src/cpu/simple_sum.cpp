@@ -42,10 +42,7 @@ void simple_sum_t<data_type>::execute() {
     const size_t tail = nelems % block_size;
 
     const auto &scales = conf_.scales_;
-#pragma omp parallel
-    {
-        const int ithr = omp_get_thread_num();
-        const int nthr = omp_get_num_threads();
+    parallel(0, [&](const int ithr, const int nthr) {
         size_t start{0}, end{0};
         balance211(blocks_number, nthr, ithr, start, end);
 
@@ -78,7 +75,7 @@ void simple_sum_t<data_type>::execute() {
                 }
             }
         }
-    }
+    });
 }
 
 template struct simple_sum_t<data_type::f32>;
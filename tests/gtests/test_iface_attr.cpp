@@ -35,6 +35,16 @@ TEST_F(attr_test, TestIntOutputRoundMode) {
     }
 }
 
+TEST_F(attr_test, TestScratchpadMode) {
+    mkldnn::primitive_attr attr;
+    EXPECT_EQ(scratchpad_mode_library, attr.get_scratchpad_mode());
+    for (auto m: {scratchpad_mode_user, scratchpad_mode_library})
+    {
+        attr.set_scratchpad_mode(m);
+        EXPECT_EQ(m, attr.get_scratchpad_mode());
+    }
+}
+
 TEST_F(attr_test, TestIntOutputScales) {
     mkldnn::primitive_attr attr;
 
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class cpu_isa_test: public ::testing::Test {
+protected:
+    virtual void SetUp() {}
+    virtual void TearDown() { set_max_cpu_isa(isa_all); }
+
+    std::string conv_impl_info() {
+        auto eng = engine(engine::kind::cpu, 0);
+        auto src = memory::desc({2, 32, 13, 13}, memory::data_type::f32,
+                memory::format::any);
+        auto wei = memory::desc({32, 32, 3, 3}, memory::data_type::f32,
+                memory::format::any);
+        auto dst = memory::desc({2, 32, 13, 13}, memory::data_type::f32,
+                memory::format::any);
+        auto conv_d = convolution_forward::desc(prop_kind::forward_training,
+                convolution_direct, src, wei, dst, {1, 1}, {1, 1}, {1, 1},
+                padding_kind::zero);
+        auto conv_pd = convolution_forward::primitive_desc(conv_d, eng);
+
+        const char *impl_info = nullptr;
+        EXPECT_EQ(mkldnn_primitive_desc_query(conv_pd.get(),
+                    mkldnn_query_impl_info_str, 0, &impl_info),
+                mkldnn_success);
+        return impl_info ? impl_info : "";
+    }
+
+    std::string int8_conv_impl_info() {
+        auto eng = engine(engine::kind::cpu, 0);
+        auto src = memory::desc({2, 32, 13, 13}, memory::data_type::u8,
+                memory::format::any);
+        auto wei = memory::desc({32, 32, 3, 3}, memory::data_type::s8,
+                memory::format::any);
+        auto dst = memory::desc({2, 32, 13, 13}, memory::data_type::s32,
+                memory::format::any);
+        auto conv_d = convolution_forward::desc(prop_kind::forward_inference,
+                convolution_direct, src, wei, dst, {1, 1}, {1, 1}, {1, 1},
+                padding_kind::zero);
+        mkldnn_primitive_desc_t pd;
+        if (mkldnn_primitive_desc_create(&pd, &conv_d.data, eng.get(),
+                    nullptr) != mkldnn_success)
+            return "";
+        const char *impl_info = nullptr;
+        EXPECT_EQ(mkldnn_primitive_desc_query(pd, mkldnn_query_impl_info_str,
+                    0, &impl_info), mkldnn_success);
+        std::string impl = impl_info ? impl_info : "";
+        mkldnn_primitive_desc_destroy(pd);
+        return impl;
+    }
+};
+
+TEST_F(cpu_isa_test, TestInvalidIsa) {
+    EXPECT_EQ(mkldnn_set_max_cpu_isa((mkldnn_cpu_isa_t)-1),
+            mkldnn_invalid_arguments);
+    EXPECT_EQ(mkldnn_set_max_cpu_isa((mkldnn_cpu_isa_t)100),
+            mkldnn_invalid_arguments);
+}
+
+TEST_F(cpu_isa_test, TestMaxIsaIsRespected) {
+    set_max_cpu_isa(sse42);
+    const std::string impl = conv_impl_info();
+    EXPECT_EQ(impl.find("avx"), std::string::npos);
+
+    set_max_cpu_isa(isa_all);
+    EXPECT_FALSE(conv_impl_info().empty());
+}
+
+TEST_F(cpu_isa_test, TestBranchesAreDistinct) {
+    /* avx512_mic does not include avx512_core, although it is greater in the
+     * enumeration */
+    if (int8_conv_impl_info().find("avx512_core") == std::string::npos)
+        return;
+
+    set_max_cpu_isa(avx512_mic);
+    EXPECT_EQ(int8_conv_impl_info().find("avx512_core"), std::string::npos);
+
+    set_max_cpu_isa(avx512_core);
+    EXPECT_NE(int8_conv_impl_info().find("avx512_core"), std::string::npos);
+}
+
+}
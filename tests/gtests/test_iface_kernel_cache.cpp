@@ -0,0 +1,105 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <string>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class kernel_cache_test: public ::testing::Test {
+protected:
+    struct conv_t {
+        std::unique_ptr<memory> src, wei, dst;
+        std::unique_ptr<convolution_forward> conv;
+    };
+
+    std::shared_ptr<convolution_forward::primitive_desc> conv_pd(int ic) {
+        auto src = memory::desc({2, ic, 13, 13}, memory::data_type::f32,
+                memory::format::any);
+        auto wei = memory::desc({32, ic, 3, 3}, memory::data_type::f32,
+                memory::format::any);
+        auto dst = memory::desc({2, 32, 13, 13}, memory::data_type::f32,
+                memory::format::any);
+        auto conv_d = convolution_forward::desc(prop_kind::forward_training,
+                convolution_direct, src, wei, dst, {1, 1}, {1, 1}, {1, 1},
+                padding_kind::zero);
+        return std::make_shared<convolution_forward::primitive_desc>(conv_d,
+                eng);
+    }
+
+    conv_t *create_conv(int ic) {
+        auto pd = conv_pd(ic);
+        conv_t *c = new conv_t;
+        c->src.reset(new memory(pd->src_primitive_desc()));
+        c->wei.reset(new memory(pd->weights_primitive_desc()));
+        c->dst.reset(new memory(pd->dst_primitive_desc()));
+        c->conv.reset(new convolution_forward(*pd, *c->src, *c->wei,
+                    *c->dst));
+        return c;
+    }
+
+    bool jit_conv_available() {
+        const char *impl_info = nullptr;
+        EXPECT_EQ(mkldnn_primitive_desc_query(conv_pd(32)->get(),
+                    mkldnn_query_impl_info_str, 0, &impl_info),
+                mkldnn_success);
+        return impl_info && std::string(impl_info).find("jit") != std::string::npos;
+    }
+
+    void expect_stats(int n_kernels, int n_references) {
+        int k, r;
+        get_jit_kernel_cache_stats(k, r);
+        EXPECT_EQ(k, n_kernels);
+        EXPECT_EQ(r, n_references);
+    }
+
+    engine eng = engine(engine::kind::cpu, 0);
+};
+
+TEST_F(kernel_cache_test, TestSharing) {
+    if (!jit_conv_available()) return;
+
+    int k0, r0;
+    get_jit_kernel_cache_stats(k0, r0);
+
+    std::unique_ptr<conv_t> c0(create_conv(32));
+    expect_stats(k0 + 1, r0 + 1);
+
+    /* the identical convolution shares the kernel */
+    std::unique_ptr<conv_t> c1(create_conv(32));
+    expect_stats(k0 + 1, r0 + 2);
+
+    /* a different shape gets its own kernel */
+    std::unique_ptr<conv_t> c2(create_conv(64));
+    expect_stats(k0 + 2, r0 + 3);
+
+    c0.reset();
+    expect_stats(k0 + 2, r0 + 2);
+
+    /* the kernel is freed with the last primitive that uses it */
+    c1.reset();
+    expect_stats(k0 + 1, r0 + 1);
+
+    c2.reset();
+    expect_stats(k0, r0);
+}
+
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class memory_consumption_test: public ::testing::Test {
+protected:
+    memory::desc md(memory::dims dims,
+            memory::format fmt = memory::format::any) {
+        return memory::desc(dims, memory::data_type::f32, fmt);
+    }
+
+    ptrdiff_t memory_consumption(const_mkldnn_primitive_desc_t pd) {
+        ptrdiff_t size = -1;
+        EXPECT_EQ(mkldnn_primitive_desc_query(pd,
+                    mkldnn_query_memory_consumption_s64, 0, &size),
+                mkldnn_success);
+        return size;
+    }
+
+    std::string impl_info(const_mkldnn_primitive_desc_t pd) {
+        const char *info = nullptr;
+        EXPECT_EQ(mkldnn_primitive_desc_query(pd, mkldnn_query_impl_info_str,
+                    0, &info), mkldnn_success);
+        return info;
+    }
+
+    engine eng = engine(engine::kind::cpu, 0);
+};
+
+TEST_F(memory_consumption_test, TestNoExtraMemory) {
+    auto relu = eltwise_forward::primitive_desc(eltwise_forward::desc(
+                prop_kind::forward_inference, algorithm::eltwise_relu,
+                md({ 2, 16, 7, 7 }, memory::format::nchw), 0.f), eng);
+    EXPECT_EQ(memory_consumption(relu.get()), 0);
+
+    auto mpd = memory::primitive_desc(md({ 2, 16, 7, 7 },
+                memory::format::nchw), eng);
+    EXPECT_EQ(memory_consumption(mpd.get()), 2 * 16 * 7 * 7 * 4);
+}
+
+TEST_F(memory_consumption_test, TestGemmConvolution) {
+    const int mb = 2, ic = 32, oc = 32, hw = 14, k = 3;
+    auto pd = convolution_forward::primitive_desc(convolution_forward::desc(
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                md({ mb, ic, hw, hw }, memory::format::nchw),
+                md({ oc, ic, k, k }, memory::format::oihw),
+                md({ mb, oc, hw, hw }, memory::format::nchw), { 1, 1 },
+                { 1, 1 }, { 1, 1 }, padding_kind::zero), eng);
+    if (impl_info(pd.get()).find("gemm") == std::string::npos) return;
+
+    /* a column buffer per thread at least */
+    const ptrdiff_t col_size = sizeof(float) * ic * k * k * hw * hw;
+    EXPECT_GE(memory_consumption(pd.get()), col_size);
+}
+
+TEST_F(memory_consumption_test, TestWinograd) {
+    std::shared_ptr<convolution_forward::primitive_desc> pd;
+    try {
+        pd.reset(new convolution_forward::primitive_desc(
+                    convolution_forward::desc(prop_kind::forward_inference,
+                        algorithm::convolution_winograd,
+                        md({ 2, 64, 28, 28 }), md({ 64, 64, 3, 3 }),
+                        md({ 2, 64, 28, 28 }), { 1, 1 }, { 1, 1 }, { 1, 1 },
+                        padding_kind::zero), eng));
+    } catch (error &e) {
+        EXPECT_EQ(e.status, mkldnn_unimplemented);
+        return;
+    }
+
+    size_t scratchpad_size = 0;
+    EXPECT_EQ(mkldnn_primitive_desc_query(pd->get(),
+                mkldnn_query_scratchpad_size, 0, &scratchpad_size),
+            mkldnn_success);
+    EXPECT_GT(scratchpad_size, 0u);
+    EXPECT_EQ((size_t)memory_consumption(pd->get()), scratchpad_size);
+}
+
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn_types.h"
+#include "mkldnn.h"
+
+namespace mkldnn {
+
+const mkldnn_status_t ok = mkldnn_success;
+
+class pd_cache_test: public ::testing::Test {
+protected:
+    mkldnn_engine_t engine;
+    mkldnn_eltwise_desc_t ed;
+
+    virtual void SetUp() {
+        EXPECT_EQ(mkldnn_engine_create(&engine, mkldnn_cpu, 0), ok);
+
+        mkldnn_memory_desc_t md;
+        mkldnn_dims_t dims = {4, 16, 16, 16};
+        EXPECT_EQ(mkldnn_memory_desc_init(&md, 4, dims, mkldnn_f32,
+                    mkldnn_nchw), ok);
+        EXPECT_EQ(mkldnn_eltwise_forward_desc_init(&ed,
+                    mkldnn_forward_inference, mkldnn_eltwise_relu, &md, 0.,
+                    0.), ok);
+    }
+    virtual void TearDown() {
+        mkldnn_engine_destroy(engine);
+    }
+
+    const char *create_pd(const mkldnn_eltwise_desc_t *desc,
+            const_mkldnn_primitive_attr_t attr = nullptr) {
+        mkldnn_primitive_desc_t pd;
+        EXPECT_EQ(mkldnn_primitive_desc_create_v2(&pd, desc, attr, engine,
+                    nullptr), ok);
+        const char *impl_info = nullptr;
+        EXPECT_EQ(mkldnn_primitive_desc_query(pd, mkldnn_query_impl_info_str,
+                    0, &impl_info), ok);
+        mkldnn_primitive_desc_destroy(pd);
+        return impl_info;
+    }
+
+    void expect_stats(size_t hits, size_t misses) {
+        size_t h, m;
+        EXPECT_EQ(mkldnn_engine_get_primitive_desc_cache_stats(engine, &h, &m),
+                ok);
+        EXPECT_EQ(h, hits);
+        EXPECT_EQ(m, misses);
+    }
+};
+
+TEST_F(pd_cache_test, TestHitsAndMisses) {
+    const char *impl0 = create_pd(&ed);
+    expect_stats(0, 1);
+    const char *impl1 = create_pd(&ed);
+    expect_stats(1, 1);
+    EXPECT_EQ(strcmp(impl0, impl1), 0);
+
+    mkldnn_eltwise_desc_t ed_other = ed;
+    ed_other.alpha = 0.5;
+    create_pd(&ed_other);
+    expect_stats(1, 2);
+
+    /* default attributes are equal to no attributes */
+    mkldnn_primitive_attr_t attr;
+    EXPECT_EQ(mkldnn_primitive_attr_create(&attr), ok);
+    create_pd(&ed, attr);
+    expect_stats(2, 2);
+
+    /* non-default attributes are a different key, whether or not any
+     * implementation supports them */
+    EXPECT_EQ(mkldnn_primitive_attr_set_int_output_round_mode(attr,
+                mkldnn_round_down), ok);
+    mkldnn_primitive_desc_t pd;
+    if (mkldnn_primitive_desc_create_v2(&pd, &ed, attr, engine, nullptr) == ok)
+        mkldnn_primitive_desc_destroy(pd);
+    expect_stats(2, 3);
+    mkldnn_primitive_attr_destroy(attr);
+}
+
+TEST_F(pd_cache_test, TestCapacity) {
+    int capacity;
+    EXPECT_EQ(mkldnn_engine_get_primitive_desc_cache_capacity(engine,
+                &capacity), ok);
+    EXPECT_GT(capacity, 0);
+
+    EXPECT_EQ(mkldnn_engine_set_primitive_desc_cache_capacity(engine, -1),
+            mkldnn_invalid_arguments);
+
+    EXPECT_EQ(mkldnn_engine_set_primitive_desc_cache_capacity(engine, 1), ok);
+    mkldnn_eltwise_desc_t ed_other = ed;
+    ed_other.alpha = 0.5;
+    create_pd(&ed);
+    create_pd(&ed_other); /* evicts ed */
+    create_pd(&ed);
+    expect_stats(0, 3);
+    create_pd(&ed);
+    expect_stats(1, 3);
+
+    EXPECT_EQ(mkldnn_engine_set_primitive_desc_cache_capacity(engine, 0), ok);
+    create_pd(&ed);
+    create_pd(&ed);
+    expect_stats(1, 3);
+}
+
+}
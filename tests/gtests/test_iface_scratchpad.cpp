@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdint.h>
+#include <vector>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class scratchpad_test: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        src_md.reset(new memory::desc(create_md({ 2, 32, 13, 13 }, f32,
+                        memory::format::any)));
+        wei_md.reset(new memory::desc(create_md({ 64, 32, 3, 3 }, f32,
+                        memory::format::any)));
+        dst_md.reset(new memory::desc(create_md({ 2, 64, 13, 13 }, f32,
+                        memory::format::any)));
+    }
+
+    convolution_forward::desc conv_desc(algorithm alg) {
+        return convolution_forward::desc(prop_kind::forward_inference, alg,
+                *src_md, *wei_md, *dst_md, { 1, 1 }, { 1, 1 }, { 1, 1 },
+                padding_kind::zero);
+    }
+
+    size_t scratchpad_size(const_mkldnn_primitive_desc_t pd) {
+        size_t size = 0;
+        EXPECT_EQ(mkldnn_primitive_desc_query(pd,
+                    mkldnn_query_scratchpad_size, 0, &size), mkldnn_success);
+        return size;
+    }
+
+    const memory::data_type f32 = memory::data_type::f32;
+    engine eng = engine(engine::kind::cpu, 0);
+    std::shared_ptr<memory::desc> src_md, wei_md, dst_md;
+};
+
+TEST_F(scratchpad_test, TestNoScratchpad) {
+    primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode_user);
+
+    auto pd = convolution_forward::primitive_desc(
+            conv_desc(algorithm::convolution_direct), attr, eng);
+    EXPECT_EQ(scratchpad_size(pd.get()), 0U);
+
+    auto conv = convolution_forward(pd, memory(pd.src_primitive_desc()),
+            memory(pd.weights_primitive_desc()),
+            memory(pd.dst_primitive_desc()));
+    EXPECT_EQ(conv.get_scratchpad_size(), 0U);
+    EXPECT_EQ(mkldnn_primitive_set_scratchpad(conv.get(), nullptr),
+            mkldnn_success);
+}
+
+TEST_F(scratchpad_test, TestLibraryMode) {
+    auto pd = convolution_forward::primitive_desc(
+            conv_desc(algorithm::convolution_direct), eng);
+    auto conv = convolution_forward(pd, memory(pd.src_primitive_desc()),
+            memory(pd.weights_primitive_desc()),
+            memory(pd.dst_primitive_desc()));
+    EXPECT_EQ(mkldnn_primitive_set_scratchpad(conv.get(), nullptr),
+            mkldnn_invalid_arguments);
+}
+
+TEST_F(scratchpad_test, TestUserScratchpad) {
+    /* winograd is the only implementation that requires a scratchpad */
+    std::shared_ptr<convolution_forward::primitive_desc> lib_pd, user_pd;
+    primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode_user);
+    try {
+        lib_pd.reset(new convolution_forward::primitive_desc(
+                    conv_desc(algorithm::convolution_winograd), eng));
+        user_pd.reset(new convolution_forward::primitive_desc(
+                    conv_desc(algorithm::convolution_winograd), attr, eng));
+    } catch (error &e) {
+        EXPECT_EQ(e.status, mkldnn_unimplemented);
+        return;
+    }
+
+    const size_t size = scratchpad_size(user_pd->get());
+    EXPECT_GT(size, 0U);
+    EXPECT_EQ(scratchpad_size(lib_pd->get()), size);
+
+    auto src = memory(user_pd->src_primitive_desc());
+    auto wei = memory(user_pd->weights_primitive_desc());
+    fill_data<float>(src.get_primitive_desc().get_size() / sizeof(float),
+            (float *)src.get_data_handle());
+    fill_data<float>(wei.get_primitive_desc().get_size() / sizeof(float),
+            (float *)wei.get_data_handle());
+
+    auto ref_dst = memory(lib_pd->dst_primitive_desc());
+    auto ref_conv = convolution_forward(*lib_pd, src, wei, ref_dst);
+    stream(stream::kind::eager).submit({ ref_conv }).wait();
+
+    auto dst = memory(user_pd->dst_primitive_desc());
+    auto conv = convolution_forward(*user_pd, src, wei, dst);
+    EXPECT_EQ(conv.get_scratchpad_size(), size);
+
+    /* the scratchpad must be aligned on a 64-byte boundary */
+    const size_t alignment = 64;
+    std::vector<char> buffer(size + alignment);
+    char *scratchpad = buffer.data() + alignment
+        - reinterpret_cast<uintptr_t>(buffer.data()) % alignment;
+    EXPECT_EQ(mkldnn_primitive_set_scratchpad(conv.get(), nullptr),
+            mkldnn_invalid_arguments);
+    EXPECT_EQ(mkldnn_primitive_set_scratchpad(conv.get(), scratchpad + 1),
+            mkldnn_invalid_arguments);
+    conv.set_scratchpad(scratchpad);
+    stream(stream::kind::eager).submit({ conv }).wait();
+
+    compare_data<float>(ref_dst, dst);
+}
+
+}
@@ -0,0 +1,276 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class stream_test: public ::testing::TestWithParam<stream::kind> {
+protected:
+    virtual void SetUp() {
+        md.reset(new memory::desc({ 2, 16, 32, 32 }, memory::data_type::f32,
+                    memory::format::nchw));
+    }
+
+    memory make_memory(float value) {
+        auto m = memory({ *md, eng });
+        float *data = (float *)m.get_data_handle();
+        for (size_t i = 0; i < size(); ++i) data[i] = value;
+        return m;
+    }
+
+    /* dst = alpha * src + beta */
+    primitive linear(const memory &src, const memory &dst, float alpha,
+            float beta) {
+        auto pd = eltwise_forward::primitive_desc(eltwise_forward::desc(
+                    prop_kind::forward_training, algorithm::eltwise_linear,
+                    *md, alpha, beta), eng);
+        return eltwise_forward(pd, src, dst);
+    }
+
+    void check(const memory &m, float value) {
+        const float *data = (const float *)m.get_data_handle();
+        for (size_t i = 0; i < size(); ++i)
+            ASSERT_EQ(data[i], value);
+    }
+
+    size_t size() const { return 2 * 16 * 32 * 32; }
+
+    engine eng = engine(engine::kind::cpu, 0);
+    std::shared_ptr<memory::desc> md;
+};
+
+TEST_P(stream_test, TestChain) {
+    auto a = make_memory(1.f), b = make_memory(0.f), c = make_memory(0.f),
+         d = make_memory(0.f);
+
+    /* b = 2a + 1, c = 2b + 1, d = 2c + 1 */
+    stream(GetParam()).submit({ linear(a, b, 2.f, 1.f),
+            linear(b, c, 2.f, 1.f), linear(c, d, 2.f, 1.f) }).wait();
+    check(d, 15.f);
+}
+
+TEST_P(stream_test, TestWriteAfterRead) {
+    auto a = make_memory(1.f), b = make_memory(0.f), c = make_memory(5.f);
+
+    /* b must read a before it is overwritten */
+    stream(GetParam()).submit({ linear(a, b, 1.f, 1.f),
+            linear(c, a, 1.f, 0.f) }).wait();
+    check(b, 2.f);
+    check(a, 5.f);
+}
+
+TEST_P(stream_test, TestBranches) {
+    auto src = make_memory(1.f);
+    std::vector<memory> mid, dst;
+    std::vector<primitive> net;
+    for (int br = 0; br < 4; ++br) {
+        mid.push_back(make_memory(0.f));
+        dst.push_back(make_memory(0.f));
+        net.push_back(linear(src, mid[br], 1.f, (float)br));
+    }
+    for (int br = 0; br < 4; ++br)
+        net.push_back(linear(mid[br], dst[br], 2.f, 0.f));
+
+    stream s(GetParam());
+    s.submit(net).wait();
+    for (int br = 0; br < 4; ++br)
+        check(dst[br], 2.f * (1.f + br));
+
+    /* the dependencies are refreshed on rerun */
+    float *data = (float *)src.get_data_handle();
+    for (size_t i = 0; i < size(); ++i) data[i] = 3.f;
+    s.rerun().wait();
+    for (int br = 0; br < 4; ++br)
+        check(dst[br], 2.f * (3.f + br));
+}
+
+TEST_P(stream_test, TestLibraryScratchpad) {
+    /* the winograd convolution uses the library-managed scratchpad, which
+     * must be valid on the thread executing the primitive */
+    memory::dims src_dims = { 2, 32, 13, 13 }, wei_dims = { 64, 32, 3, 3 },
+        dst_dims = { 2, 64, 13, 13 };
+    const auto f32 = memory::data_type::f32;
+    const auto any = memory::format::any;
+    auto conv_desc = [&](algorithm alg) {
+        return convolution_forward::desc(prop_kind::forward_inference, alg,
+                memory::desc(src_dims, f32, any),
+                memory::desc(wei_dims, f32, any),
+                memory::desc(dst_dims, f32, any), { 1, 1 }, { 1, 1 },
+                { 1, 1 }, padding_kind::zero);
+    };
+
+    std::shared_ptr<convolution_forward::primitive_desc> pd;
+    try {
+        pd.reset(new convolution_forward::primitive_desc(
+                    conv_desc(algorithm::convolution_winograd), eng));
+    } catch (error &e) {
+        EXPECT_EQ(e.status, mkldnn_unimplemented);
+        return;
+    }
+
+    auto src = memory(pd->src_primitive_desc());
+    auto wei = memory(pd->weights_primitive_desc());
+    fill_data<float>(src.get_primitive_desc().get_size() / sizeof(float),
+            (float *)src.get_data_handle());
+    fill_data<float>(wei.get_primitive_desc().get_size() / sizeof(float),
+            (float *)wei.get_data_handle());
+
+    auto ref_dst = memory(pd->dst_primitive_desc());
+    stream(stream::kind::eager).submit(
+            { convolution_forward(*pd, src, wei, ref_dst) }).wait();
+
+    std::vector<memory> dst;
+    std::vector<primitive> net;
+    for (int br = 0; br < 2; ++br) {
+        dst.push_back(memory(pd->dst_primitive_desc()));
+        net.push_back(convolution_forward(*pd, src, wei, dst[br]));
+    }
+    stream(GetParam()).submit(net).wait();
+    for (int br = 0; br < 2; ++br)
+        compare_data<float>(ref_dst, dst[br]);
+}
+
+TEST_P(stream_test, TestNonBlockingWait) {
+    auto a = make_memory(1.f), b = make_memory(0.f);
+
+    /* the primitives must stay alive until the stream is done */
+    std::vector<primitive> net = { linear(a, b, 1.f, 1.f),
+        linear(b, a, 1.f, 1.f) };
+    stream s(GetParam());
+    s.submit(net);
+    while (!s.wait(false));
+    check(a, 3.f);
+    EXPECT_TRUE(s.wait());
+}
+
+TEST_P(stream_test, TestFusedConvolution) {
+    /* the lazy stream merges the relu and the in-place sum into the
+     * convolutions, the results must not change */
+    memory::dims src_dims = { 2, 32, 13, 13 }, wei_dims = { 32, 32, 3, 3 };
+    const auto f32 = memory::data_type::f32;
+    const auto any = memory::format::any;
+    auto pd = convolution_forward::primitive_desc(
+            convolution_forward::desc(prop_kind::forward_inference,
+                algorithm::convolution_direct,
+                memory::desc(src_dims, f32, any),
+                memory::desc(wei_dims, f32, any),
+                memory::desc(src_dims, f32, any), { 1, 1 }, { 1, 1 },
+                { 1, 1 }, padding_kind::zero), eng);
+    auto dst_md = pd.dst_primitive_desc().desc();
+    auto relu_pd = eltwise_forward::primitive_desc(eltwise_forward::desc(
+                prop_kind::forward_inference, algorithm::eltwise_relu,
+                dst_md, 0.f), eng);
+    auto sum_pd = sum::primitive_desc(dst_md, std::vector<float>{ 1.f, 1.f },
+            { pd.dst_primitive_desc(), pd.dst_primitive_desc() });
+
+    auto src = memory(pd.src_primitive_desc());
+    auto wei = memory(pd.weights_primitive_desc());
+    fill_data<float>(src.get_primitive_desc().get_size() / sizeof(float),
+            (float *)src.get_data_handle());
+    fill_data<float>(wei.get_primitive_desc().get_size() / sizeof(float),
+            (float *)wei.get_data_handle());
+
+    /* mid = relu(conv(src)), dst = conv(mid) + dst */
+    auto run = [&](stream::kind kind, memory &dst) {
+        auto mid = memory(pd.dst_primitive_desc());
+        auto tmp = memory(pd.dst_primitive_desc());
+        auto data = (float *)dst.get_data_handle();
+        for (size_t i = 0; i < dst.get_primitive_desc().get_size()
+                / sizeof(float); ++i)
+            data[i] = 1.f;
+        std::vector<primitive::at> summands = { tmp, dst };
+        std::vector<primitive> net = {
+            convolution_forward(pd, src, wei, mid),
+            eltwise_forward(relu_pd, mid, mid),
+            convolution_forward(pd, mid, wei, tmp),
+            sum(sum_pd, summands, dst) };
+        stream s(kind);
+        s.submit(net).wait();
+        s.rerun().wait();
+    };
+
+    auto ref_dst = memory(pd.dst_primitive_desc());
+    auto dst = memory(pd.dst_primitive_desc());
+    run(stream::kind::eager, ref_dst);
+    run(GetParam(), dst);
+    compare_data<float>(ref_dst, dst);
+}
+
+TEST_P(stream_test, TestReorderPair) {
+    auto a = make_memory(0.f), b = make_memory(0.f);
+    float *data = (float *)a.get_data_handle();
+    for (size_t i = 0; i < size(); ++i) data[i] = (float)i;
+
+    auto blocked = memory({ { { 2, 16, 32, 32 }, memory::data_type::f32,
+            memory::format::nChw16c }, eng });
+    auto chwn = memory({ { { 2, 16, 32, 32 }, memory::data_type::f32,
+            memory::format::chwn }, eng });
+
+    /* a -> blocked -> b is a single copy, a -> chwn -> a does nothing */
+    stream(GetParam()).submit({ reorder(a, blocked), reorder(blocked, b),
+            reorder(a, chwn), reorder(chwn, a) }).wait();
+    const float *a_data = (const float *)a.get_data_handle();
+    const float *b_data = (const float *)b.get_data_handle();
+    for (size_t i = 0; i < size(); ++i) {
+        ASSERT_EQ(a_data[i], (float)i);
+        ASSERT_EQ(b_data[i], (float)i);
+    }
+}
+
+TEST_F(stream_test, TestLazyPlansMemory) {
+    auto a = make_memory(1.f);
+    std::vector<memory> mid;
+    for (int i = 0; i < 4; ++i) mid.push_back(memory({ *md, eng }, nullptr));
+
+    /* the memories without a data handle are allocated by the stream, the
+     * ones with disjoint lifetimes share the storage */
+    std::vector<primitive> net = { linear(a, mid[0], 2.f, 1.f),
+        linear(mid[0], mid[1], 2.f, 1.f), linear(mid[1], mid[2], 2.f, 1.f),
+        linear(mid[2], mid[3], 2.f, 1.f) };
+    stream s(stream::kind::lazy);
+    s.submit(net).wait();
+    check(mid[3], 31.f);
+    EXPECT_EQ(mid[0].get_data_handle(), mid[2].get_data_handle());
+    EXPECT_NE(mid[0].get_data_handle(), mid[1].get_data_handle());
+    EXPECT_NE(mid[2].get_data_handle(), mid[3].get_data_handle());
+
+    float *data = (float *)a.get_data_handle();
+    for (size_t i = 0; i < size(); ++i) data[i] = 0.f;
+    s.rerun().wait();
+    check(mid[3], 15.f);
+}
+
+TEST_F(stream_test, TestEagerIsSynchronous) {
+    auto a = make_memory(1.f), b = make_memory(0.f);
+
+    /* the eager stream executes the primitives at the submission */
+    stream s(stream::kind::eager);
+    s.submit({ linear(a, b, 1.f, 1.f) });
+    check(b, 2.f);
+    EXPECT_TRUE(s.wait(false));
+}
+
+INSTANTIATE_TEST_CASE_P(TestStream, stream_test,
+        ::testing::Values(stream::kind::eager, stream::kind::lazy,
+            stream::kind::eager_async));
+
+}
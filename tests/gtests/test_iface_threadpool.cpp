@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+/* runs the tasks on threads spawned for each parallel_for() call */
+struct test_threadpool_t: public threadpool_iface {
+    test_threadpool_t(int nthr): nthr_(nthr), ncalls_(0) {}
+
+    virtual int get_num_threads() { return nthr_; }
+
+    virtual void parallel_for(int n, const std::function<void(int, int)> &fn) {
+        ++ncalls_;
+        std::atomic<int> next(0);
+        auto worker = [&]() { for (int i; (i = next++) < n; ) fn(i, n); };
+
+        std::vector<std::thread> workers;
+        for (int t = 1; t < nthr_; ++t)
+            workers.emplace_back(worker);
+        worker();
+        for (auto &w: workers)
+            w.join();
+    }
+
+    int ncalls() const { return ncalls_; }
+
+private:
+    int nthr_;
+    std::atomic<int> ncalls_;
+};
+
+class threadpool_test: public ::testing::Test {
+protected:
+    /* the threadpool streams exist only if the library is built with
+     * MKLDNN_THREADING=THREADPOOL */
+    bool threadpool_supported() {
+        test_threadpool_t tp(1);
+        try {
+            stream s(stream::kind::eager, tp);
+        } catch (error &e) {
+            EXPECT_EQ(e.status, mkldnn_unimplemented);
+            return false;
+        }
+        return true;
+    }
+};
+
+TEST_F(threadpool_test, TestStreamCreation) {
+    mkldnn_stream_t s;
+    mkldnn_status_t expected_status = threadpool_supported()
+        ? mkldnn_invalid_arguments : mkldnn_unimplemented;
+    EXPECT_EQ(mkldnn_stream_create_with_threadpool(&s, mkldnn_eager, nullptr),
+            expected_status);
+
+    mkldnn_threadpool_t tp = {};
+    EXPECT_EQ(mkldnn_stream_create_with_threadpool(&s, mkldnn_eager, &tp),
+            expected_status);
+}
+
+TEST_F(threadpool_test, TestConvolution) {
+    if (!threadpool_supported())
+        return;
+
+    using fmt = memory::format;
+    const auto f32 = memory::data_type::f32;
+    auto eng = engine(engine::kind::cpu, 0);
+
+    auto src_md = create_md({ 8, 32, 14, 14 }, f32, fmt::nChw16c);
+    auto wei_md = create_md({ 32, 32, 3, 3 }, f32, fmt::OIhw16i16o);
+    auto bia_md = create_md({ 32 }, f32, fmt::x);
+    auto dst_md = create_md({ 8, 32, 14, 14 }, f32, fmt::nChw16c);
+
+    auto fwd_pd = convolution_forward::primitive_desc(
+            convolution_forward::desc(prop_kind::forward_training,
+                algorithm::convolution_direct, src_md, wei_md, bia_md, dst_md,
+                { 1, 1 }, { 1, 1 }, { 1, 1 }, padding_kind::zero), eng);
+    auto bwd_w_pd = convolution_backward_weights::primitive_desc(
+            convolution_backward_weights::desc(algorithm::convolution_direct,
+                src_md, wei_md, bia_md, dst_md, { 1, 1 }, { 1, 1 }, { 1, 1 },
+                padding_kind::zero), eng, fwd_pd);
+
+    auto src = memory({ src_md, eng });
+    auto wei = memory({ wei_md, eng });
+    auto bia = memory({ bia_md, eng });
+    auto dst = memory({ dst_md, eng });
+    fill_data<float>(src.get_primitive_desc().get_size() / sizeof(float),
+            (float *)src.get_data_handle());
+    fill_data<float>(wei.get_primitive_desc().get_size() / sizeof(float),
+            (float *)wei.get_data_handle());
+    fill_data<float>(bia.get_primitive_desc().get_size() / sizeof(float),
+            (float *)bia.get_data_handle());
+    fill_data<float>(dst.get_primitive_desc().get_size() / sizeof(float),
+            (float *)dst.get_data_handle());
+
+    /* the streams without a threadpool execute the primitives sequentially,
+     * which gives the reference results */
+    auto test = [&](const std::vector<memory> &outs,
+            std::function<primitive(const std::vector<memory> &)> create) {
+        std::vector<memory> ref_outs;
+        for (auto &m: outs)
+            ref_outs.push_back(memory(m.get_primitive_desc()));
+
+        stream(stream::kind::eager).submit({ create(ref_outs) }).wait();
+
+        test_threadpool_t tp(4);
+        stream(stream::kind::eager, tp).submit({ create(outs) }).wait();
+        /* the number of threads is capped by the number of cores */
+        if (std::thread::hardware_concurrency() > 1)
+            EXPECT_GT(tp.ncalls(), 0);
+
+        for (size_t i = 0; i < outs.size(); ++i) {
+            memory out = outs[i], ref_out = ref_outs[i];
+            compare_data<float>(ref_out, out);
+        }
+    };
+
+    test({ memory({ dst_md, eng }) }, [&](const std::vector<memory> &o) {
+        return convolution_forward(fwd_pd, src, wei, bia, o[0]);
+    });
+
+    test({ memory({ wei_md, eng }), memory({ bia_md, eng }) },
+            [&](const std::vector<memory> &o) {
+        return convolution_backward_weights(bwd_w_pd, src, dst, o[0], o[1]);
+    });
+}
+
+TEST_F(threadpool_test, TestExecute) {
+    const auto f32 = memory::data_type::f32;
+    auto eng = engine(engine::kind::cpu, 0);
+    auto md = create_md({ 8, 32, 14, 14 }, f32, memory::format::nchw);
+
+    auto src = memory({ md, eng });
+    fill_data<float>(src.get_primitive_desc().get_size() / sizeof(float),
+            (float *)src.get_data_handle());
+    auto ref_dst = memory({ md, eng }), dst = memory({ md, eng });
+
+    auto relu_pd = eltwise_forward::primitive_desc(
+            eltwise_forward::desc(prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, 0.f), eng);
+    stream(stream::kind::eager).submit(
+            { eltwise_forward(relu_pd, src, ref_dst) }).wait();
+
+    /* the library threads are used without a threadpool in any build */
+    auto relu = eltwise_forward(relu_pd, src, dst);
+    relu.execute();
+    compare_data<float>(ref_dst, dst);
+
+    EXPECT_EQ(mkldnn_primitive_execute(nullptr, nullptr),
+            mkldnn_invalid_arguments);
+
+    test_threadpool_t tp(4);
+    if (!threadpool_supported()) {
+        mkldnn_threadpool_t c_tp = tp.get_c_threadpool();
+        EXPECT_EQ(mkldnn_primitive_execute(relu.get(), &c_tp),
+                mkldnn_unimplemented);
+        return;
+    }
+
+    auto dst_tp = memory({ md, eng });
+    eltwise_forward(relu_pd, src, dst_tp).execute(&tp);
+    if (std::thread::hardware_concurrency() > 1)
+        EXPECT_GT(tp.ncalls(), 0);
+    compare_data<float>(ref_dst, dst_tp);
+}
+
+}
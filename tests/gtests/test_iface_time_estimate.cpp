@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class time_estimate_test: public ::testing::Test {
+protected:
+    memory::desc md(memory::dims dims,
+            memory::format fmt = memory::format::any) {
+        return memory::desc(dims, memory::data_type::f32, fmt);
+    }
+
+    convolution_forward::desc conv_desc(algorithm alg, int mb, int ic,
+            int oc, int hw, int k) {
+        const int pad = k / 2;
+        return convolution_forward::desc(prop_kind::forward_inference, alg,
+                md({ mb, ic, hw, hw }), md({ oc, ic, k, k }),
+                md({ mb, oc, hw, hw }), { 1, 1 }, { pad, pad },
+                { pad, pad }, padding_kind::zero);
+    }
+
+    double time_estimate(const_mkldnn_primitive_desc_t pd) {
+        double time = 0;
+        EXPECT_EQ(mkldnn_primitive_desc_query(pd,
+                    mkldnn_query_time_estimate_f64, 0, &time),
+                mkldnn_success);
+        return time;
+    }
+
+    engine eng = engine(engine::kind::cpu, 0);
+};
+
+TEST_F(time_estimate_test, TestConvolution) {
+    auto small = convolution_forward::primitive_desc(
+            conv_desc(algorithm::convolution_direct, 2, 32, 32, 14, 3), eng);
+    auto large = convolution_forward::primitive_desc(
+            conv_desc(algorithm::convolution_direct, 8, 32, 32, 14, 3), eng);
+    EXPECT_GT(time_estimate(small.get()), 0.);
+    EXPECT_GT(time_estimate(large.get()), time_estimate(small.get()));
+}
+
+TEST_F(time_estimate_test, TestWinogradVsDirect) {
+    /* winograd does ~4x less arithmetic on a large 3x3 convolution */
+    auto direct = convolution_forward::primitive_desc(
+            conv_desc(algorithm::convolution_direct, 32, 64, 64, 56, 3),
+            eng);
+    std::shared_ptr<convolution_forward::primitive_desc> winograd;
+    try {
+        winograd.reset(new convolution_forward::primitive_desc(
+                    conv_desc(algorithm::convolution_winograd, 32, 64, 64,
+                        56, 3), eng));
+    } catch (error &e) {
+        EXPECT_EQ(e.status, mkldnn_unimplemented);
+        return;
+    }
+    EXPECT_LT(time_estimate(winograd->get()), time_estimate(direct.get()));
+}
+
+TEST_F(time_estimate_test, TestOtherPrimitives) {
+    auto src_md = md({ 2, 16, 28, 28 }, memory::format::nchw);
+
+    auto pool = pooling_forward::primitive_desc(pooling_forward::desc(
+                prop_kind::forward_inference, algorithm::pooling_max, src_md,
+                md({ 2, 16, 14, 14 }, memory::format::nchw), { 2, 2 },
+                { 2, 2 }, { 0, 0 }, { 0, 0 }, padding_kind::zero), eng);
+    EXPECT_GT(time_estimate(pool.get()), 0.);
+
+    auto bnorm = batch_normalization_forward::primitive_desc(
+            batch_normalization_forward::desc(prop_kind::forward_inference,
+                src_md, 1e-5, 0u), eng);
+    EXPECT_GT(time_estimate(bnorm.get()), 0.);
+
+    auto ip = inner_product_forward::primitive_desc(
+            inner_product_forward::desc(prop_kind::forward_inference, src_md,
+                md({ 10, 16, 28, 28 }), md({ 2, 10 })), eng);
+    EXPECT_GT(time_estimate(ip.get()), 0.);
+}
+
+TEST_F(time_estimate_test, TestNoCostModel) {
+    auto relu = eltwise_forward::primitive_desc(eltwise_forward::desc(
+                prop_kind::forward_inference, algorithm::eltwise_relu,
+                md({ 2, 16, 28, 28 }, memory::format::nchw), 0.f), eng);
+    double time = 0;
+    EXPECT_EQ(mkldnn_primitive_desc_query(relu.get(),
+                mkldnn_query_time_estimate_f64, 0, &time),
+            mkldnn_unimplemented);
+}
+
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class tuning_test: public ::testing::Test {
+protected:
+    memory::desc md(memory::dims dims,
+            memory::format fmt = memory::format::any) {
+        return memory::desc(dims, memory::data_type::f32, fmt);
+    }
+
+    convolution_forward::desc conv_desc() {
+        return convolution_forward::desc(prop_kind::forward_inference,
+                algorithm::convolution_direct, md({ 2, 16, 14, 14 }),
+                md({ 16, 16, 3, 3 }), md({ 2, 16, 14, 14 }), { 1, 1 },
+                { 1, 1 }, { 1, 1 }, padding_kind::zero);
+    }
+
+    std::string impl_name(const_mkldnn_primitive_desc_t pd) {
+        const char *name = nullptr;
+        EXPECT_EQ(mkldnn_primitive_desc_query(pd,
+                    mkldnn_query_impl_info_str, 0, &name), mkldnn_success);
+        return name ? name : "";
+    }
+
+    void TearDown() { eng.set_tuning(false); }
+
+    engine eng = engine(engine::kind::cpu, 0);
+};
+
+TEST_F(tuning_test, TestToggle) {
+    EXPECT_FALSE(eng.get_tuning());
+    eng.set_tuning(true);
+    EXPECT_TRUE(eng.get_tuning());
+    eng.set_tuning(false);
+    EXPECT_FALSE(eng.get_tuning());
+}
+
+TEST_F(tuning_test, TestChoiceIsRemembered) {
+    /* a cached primitive descriptor would hide the tuner */
+    const int capacity = eng.get_primitive_desc_cache_capacity();
+    eng.set_primitive_desc_cache_capacity(0);
+    eng.set_tuning(true);
+
+    auto first = convolution_forward::primitive_desc(conv_desc(), eng);
+    auto second = convolution_forward::primitive_desc(conv_desc(), eng);
+    EXPECT_EQ(impl_name(first.get()), impl_name(second.get()));
+
+    /* the tuned choice is still a valid implementation of the operation */
+    auto src = memory(first.src_primitive_desc());
+    auto weights = memory(first.weights_primitive_desc());
+    auto dst = memory(first.dst_primitive_desc());
+    auto conv = convolution_forward(first, src, weights, dst);
+    std::vector<primitive> net = { conv };
+    stream(stream::kind::eager).submit(net).wait();
+
+    eng.set_primitive_desc_cache_capacity(capacity);
+}
+
+TEST_F(tuning_test, TestUntunedIsFirstImplementation) {
+    auto desc = conv_desc();
+    auto untuned = convolution_forward::primitive_desc(desc, eng);
+    mkldnn_primitive_desc_iterator_t it;
+    ASSERT_EQ(mkldnn_primitive_desc_iterator_create(&it, &desc.data,
+                eng.get(), nullptr), mkldnn_success);
+    const_mkldnn_primitive_desc_t first
+        = mkldnn_primitive_desc_iterator_fetch(it);
+    EXPECT_EQ(impl_name(untuned.get()), impl_name(first));
+    mkldnn_primitive_desc_destroy((mkldnn_primitive_desc_t)first);
+    mkldnn_primitive_desc_iterator_destroy(it);
+}
+
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+class verbose_test: public ::testing::Test {
+protected:
+    virtual void SetUp() {}
+    virtual void TearDown() { verbose_set(0); }
+};
+
+TEST_F(verbose_test, TestSetLevel) {
+    EXPECT_EQ(mkldnn_verbose_set(-1), mkldnn_invalid_arguments);
+    EXPECT_EQ(mkldnn_verbose_set(3), mkldnn_invalid_arguments);
+    for (int level = 0; level <= 2; ++level)
+        EXPECT_EQ(mkldnn_verbose_set(level), mkldnn_success);
+}
+
+TEST_F(verbose_test, TestCreateAndExecute) {
+    auto eng = engine(engine::kind::cpu, 0);
+    auto md = memory::desc({2, 16, 4, 4}, memory::data_type::f32,
+            memory::format::nchw);
+    auto src = memory({md, eng});
+    auto dst = memory({md, eng});
+    auto reorder_src = memory({{{2, 16, 4, 4}, memory::data_type::f32,
+            memory::format::nChw8c}, eng});
+
+    verbose_set(2);
+    auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, 0.f);
+    auto relu_pd = eltwise_forward::primitive_desc(relu_d, eng);
+    auto relu = eltwise_forward(relu_pd, src, dst);
+    auto r = reorder(reorder_src, src);
+
+    std::vector<primitive> pipeline = { r, relu };
+
+    testing::internal::CaptureStdout();
+    EXPECT_NO_THROW(stream(stream::kind::eager).submit(pipeline).wait());
+    const std::string exec_out = testing::internal::GetCapturedStdout();
+    EXPECT_NE(exec_out.find("mkldnn_verbose,exec,reorder,"),
+            std::string::npos);
+    EXPECT_NE(exec_out.find("mkldnn_verbose,exec,eltwise,"),
+            std::string::npos);
+    EXPECT_NE(exec_out.find("in0:f32:nchw:2x16x4x4 out0:f32:nchw:2x16x4x4"),
+            std::string::npos);
+
+    testing::internal::CaptureStdout();
+    auto relu2 = eltwise_forward(relu_pd, src, dst);
+    const std::string create_out = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(create_out.find("mkldnn_verbose,create,eltwise,"), 0u);
+
+    /* nothing is printed at level 0 */
+    verbose_set(0);
+    testing::internal::CaptureStdout();
+    auto relu3 = eltwise_forward(relu_pd, src, dst);
+    stream(stream::kind::eager).submit({ relu3 }).wait();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+}
+
+}